@@ -1,7 +1,11 @@
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "ntk.h"
+#include "ntk_charset_tables.h"
+#include "ntk_cjk_tables.h"
+#include "ntk_html_entities.h"
 
 enum states_is_utf8
 {
@@ -37,8 +41,547 @@ enum masks
   hi4_overflow = 0xF5,
 };
 
+static enum states_is_utf8 advance_start(unsigned char c);
 static enum states_is_utf8 advance(unsigned char c, enum states_is_utf8 state);
 
+// Word-at-a-time (SWAR) helpers. Each byte of a 64-bit word is treated as a lane; a lane "matches" when its high bit
+// is set in the returned mask. Loads go through memcpy, so buffers need no particular alignment.
+static const uint64_t swar_ones = 0x0101010101010101ULL;
+static const uint64_t swar_highs = 0x8080808080808080ULL;
+
+static uint64_t swar_load(const char* p)
+{
+  uint64_t word;
+  memcpy(&word, p, sizeof(word));
+  return word;
+}
+
+static uint64_t swar_zero(const uint64_t word)
+{
+  // Adding 0x7F to the low 7 bits carries into bit 7 unless they are all zero, and can never carry out of the lane
+  const uint64_t lows = ~swar_highs;
+  return ~(((word & lows) + lows) | word) & swar_highs;
+}
+
+static uint64_t swar_below(const uint64_t word, const unsigned bound)
+{
+  // A lane below bound (at most 0x80) borrows into its high bit, which was clear. Any borrow into a higher lane comes
+  // from a lane which has already matched, so the mask may be inexact above the first match.
+  return (word - swar_ones * bound) & ~word & swar_highs;
+}
+
+static uint64_t swar_ascii_letters(const uint64_t word)
+{
+  // Fold to lowercase, then compare every lane against 'a' and 'z' at once. Setting each lane's high bit first keeps
+  // the subtractions from borrowing across lanes.
+  const uint64_t folded = (word | (swar_ones * 0x20U)) | swar_highs;
+  const uint64_t aboveA = folded - swar_ones * 'a';
+  const uint64_t aboveZ = folded - swar_ones * ('z' + 1U);
+  return aboveA & ~aboveZ & ~word & swar_highs;
+}
+
+static uint64_t swar_ascii_digits(const uint64_t word)
+{
+  // As swar_ascii_letters, without folding case
+  const uint64_t high = word | swar_highs;
+  const uint64_t above0 = high - swar_ones * '0';
+  const uint64_t above9 = high - swar_ones * ('9' + 1U);
+  return above0 & ~above9 & ~word & swar_highs;
+}
+
+static uint64_t swar_at_least(const uint64_t word, const unsigned bound)
+{
+  // Setting each lane's high bit first stops the subtraction borrowing across lanes, so unlike swar_below this is exact
+  // in every lane. Lanes at or above 0x80 always match.
+  return ((word | swar_highs) - swar_ones * bound) & swar_highs;
+}
+
+static size_t swar_count(const uint64_t mask)
+{
+  // Move each lane's flag to the bottom bit of the lane, then sum all lanes into the top byte
+  return (size_t)((((mask & swar_highs) >> 7U) * swar_ones) >> 56U);
+}
+
+static size_t swar_sum(const uint64_t lanes)
+{
+  // Add pairs of lanes into 16-bit lanes first, so a total of up to 8 * 0xFF cannot overflow
+  const uint64_t pairs = (lanes & 0x00FF00FF00FF00FFULL) + ((lanes >> 8U) & 0x00FF00FF00FF00FFULL);
+  return (size_t)((pairs * 0x0001000100010001ULL) >> 48U);
+}
+
+static const uint64_t swar16_ones = 0x0001000100010001ULL;
+static const uint64_t swar16_highs = 0x8000800080008000ULL;
+static const uint64_t swar16_lows = 0x7FFF7FFF7FFF7FFFULL;
+
+static const uint64_t swar16_above_7_bits = 0xFF80FF80FF80FF80ULL;
+static const uint64_t swar16_above_11_bits = 0xF800F800F800F800ULL;
+static const uint64_t swar16_surrogates = 0xD800D800D800D800ULL;
+static const size_t swar16_lanes = sizeof(uint64_t) / sizeof(uint16_t);
+
+static uint64_t swar16_load(const uint16_t* p)
+{
+  uint64_t word;
+  memcpy(&word, p, sizeof(word));
+  return word;
+}
+
+static uint64_t swar16_swap(const uint64_t word)
+{
+  // Exchange the two bytes of every lane
+  const uint64_t lowBytes = 0x00FF00FF00FF00FFULL;
+  return ((word & lowBytes) << 8U) | ((word >> 8U) & lowBytes);
+}
+
+static uint16_t swap16(const uint16_t c)
+{
+  return (uint16_t)((unsigned)(c << 8U) | (unsigned)(c >> 8U));
+}
+
+static uint32_t swap32(const uint32_t c)
+{
+  return (c << 24U) | ((c & 0xFF00U) << 8U) | ((c >> 8U) & 0xFF00U) | (c >> 24U);
+}
+
+static int host_is_big_endian(void)
+{
+  const uint16_t probe = 1;
+  unsigned char first;
+  memcpy(&first, &probe, 1);
+  return first == 0;
+}
+
+static uint64_t swar16_nonzero(const uint64_t word)
+{
+  // Adding 0x7FFF to the low 15 bits carries into bit 15 unless they are all zero, and can never carry out of the lane
+  return (((word & swar16_lows) + swar16_lows) | word) & swar16_highs;
+}
+
+static size_t swar16_count(const uint64_t mask)
+{
+  return (size_t)((((mask & swar16_highs) >> 15U) * swar16_ones) >> 48U);
+}
+
+static const uint32_t invalid_code_point = 0xFFFFFFFFU;
+static const size_t conversion_failed = SIZE_MAX;
+
+enum sniffing
+{
+  sniff_sample_len = 65536,
+  sniff_max_candidates = 32,
+};
+
+// Single-byte character sets in the order ntk_sniff_encoding prefers them when they score equally
+static const enum ntk_charset sniff_charset_order[] = {
+  ntk_charset_windows_1252, ntk_charset_iso_8859_15, ntk_charset_iso_8859_1,  ntk_charset_windows_1250,
+  ntk_charset_iso_8859_2,   ntk_charset_windows_1251, ntk_charset_koi8_r,     ntk_charset_iso_8859_5,
+  ntk_charset_windows_1253, ntk_charset_iso_8859_7,  ntk_charset_windows_1254, ntk_charset_iso_8859_9,
+  ntk_charset_windows_1255, ntk_charset_iso_8859_8,  ntk_charset_windows_1256, ntk_charset_iso_8859_6,
+  ntk_charset_windows_1257, ntk_charset_iso_8859_13, ntk_charset_windows_1258, ntk_charset_iso_8859_3,
+  ntk_charset_iso_8859_4,   ntk_charset_iso_8859_10, ntk_charset_iso_8859_11, ntk_charset_iso_8859_14,
+  ntk_charset_iso_8859_16,
+};
+
+// A double-byte table covering every pair of a contiguous lead range and a contiguous trail range
+struct double_byte_table
+{
+  unsigned leadMin;
+  unsigned leadMax;
+  unsigned trailMin;
+  unsigned trailMax;
+  const uint16_t* pTable;
+};
+
+static const struct double_byte_table gb18030_double_byte = {
+  gb18030_lead_min, gb18030_lead_max, gb18030_trail_min, gb18030_trail_max, gb18030_table,
+};
+
+static const struct double_byte_table big5_double_byte = {
+  big5_lead_min, big5_lead_max, big5_trail_min, big5_trail_max, big5_table,
+};
+
+static const struct double_byte_table euc_kr_double_byte = {
+  euc_kr_lead_min, euc_kr_lead_max, euc_kr_trail_min, euc_kr_trail_max, euc_kr_table,
+};
+
+enum gb18030_pointers
+{
+  gb18030_bmp_pointers = 39420,
+  gb18030_supplementary_first = 189000,
+  gb18030_supplementary_last = 1237575,
+};
+
+// The replacement for one byte in an escaping context
+struct escape
+{
+  const char* pText;
+  size_t len;
+};
+
+enum
+{
+  escape_max_ranges = 4,
+};
+
+// An escaping context. Each byte listed in pSpecials (at most a handful), and each byte below the value of below
+// (at most 0x80, or 0 for none), is replaced by its entry in escapes; every other byte is copied. Clean runs are found
+// a word at a time by comparing against each special byte and the lower bound at once. Custom tables list their
+// specials as up to escape_max_ranges inclusive ranges of ASCII instead, each of which costs a few operations a word.
+struct escape_table
+{
+  const char* pSpecials;
+  unsigned below;
+  struct escape escapes[256];
+  unsigned rangeCount;
+  unsigned char ranges[escape_max_ranges][2];
+};
+
+static const struct escape_table html_text_escapes = {
+  "&<>\"'",
+  0,
+  {
+    ['&'] = {"&amp;", 5},
+    ['<'] = {"&lt;", 4},
+    ['>'] = {"&gt;", 4},
+    ['"'] = {"&quot;", 6},
+    ['\''] = {"&#39;", 5},
+  },
+  0,
+  {{0, 0}},
+};
+
+static const struct escape_table html_double_quoted_escapes = {
+  "&\"",
+  0,
+  {
+    ['&'] = {"&amp;", 5},
+    ['"'] = {"&quot;", 6},
+  },
+  0,
+  {{0, 0}},
+};
+
+static const struct escape_table html_single_quoted_escapes = {
+  "&'",
+  0,
+  {
+    ['&'] = {"&amp;", 5},
+    ['\''] = {"&#39;", 5},
+  },
+  0,
+  {{0, 0}},
+};
+
+// Unquoted values end at whitespace, so every control character and space is written as a character reference
+static const struct escape_table html_unquoted_escapes = {
+  "&<>\"'`=",
+  0x21,
+  {
+    [0x00] = {"&#65533;", 8}, [0x01] = {"&#1;", 4}, [0x02] = {"&#2;", 4}, [0x03] = {"&#3;", 4}, [0x04] = {"&#4;", 4},
+    [0x05] = {"&#5;", 4}, [0x06] = {"&#6;", 4}, [0x07] = {"&#7;", 4}, [0x08] = {"&#8;", 4}, [0x09] = {"&#9;", 4},
+    [0x0A] = {"&#10;", 5}, [0x0B] = {"&#11;", 5}, [0x0C] = {"&#12;", 5}, [0x0D] = {"&#13;", 5}, [0x0E] = {"&#14;", 5},
+    [0x0F] = {"&#15;", 5}, [0x10] = {"&#16;", 5}, [0x11] = {"&#17;", 5}, [0x12] = {"&#18;", 5}, [0x13] = {"&#19;", 5},
+    [0x14] = {"&#20;", 5}, [0x15] = {"&#21;", 5}, [0x16] = {"&#22;", 5}, [0x17] = {"&#23;", 5}, [0x18] = {"&#24;", 5},
+    [0x19] = {"&#25;", 5}, [0x1A] = {"&#26;", 5}, [0x1B] = {"&#27;", 5}, [0x1C] = {"&#28;", 5}, [0x1D] = {"&#29;", 5},
+    [0x1E] = {"&#30;", 5}, [0x1F] = {"&#31;", 5}, [0x20] = {"&#32;", 5},
+    ['&'] = {"&amp;", 5},
+    ['<'] = {"&lt;", 4},
+    ['>'] = {"&gt;", 4},
+    ['"'] = {"&quot;", 6},
+    ['\''] = {"&#39;", 5},
+    ['`'] = {"&#96;", 5},
+    ['='] = {"&#61;", 5},
+  },
+  0,
+  {{0, 0}},
+};
+
+// A range of code points outside ASCII which an escaping context replaces
+struct code_point_escape
+{
+  uint32_t first;
+  uint32_t last;
+  struct escape escape;
+};
+
+static const struct escape replacement_escape = {"\xEF\xBF\xBD", 3};
+
+static const struct escape_table json_escapes = {
+  "\"\\",
+  0x20,
+  {
+    [0x00] = {"\\u0000", 6}, [0x01] = {"\\u0001", 6}, [0x02] = {"\\u0002", 6}, [0x03] = {"\\u0003", 6},
+    [0x04] = {"\\u0004", 6}, [0x05] = {"\\u0005", 6}, [0x06] = {"\\u0006", 6}, [0x07] = {"\\u0007", 6},
+    [0x08] = {"\\b", 2}, [0x09] = {"\\t", 2}, [0x0A] = {"\\n", 2}, [0x0B] = {"\\u000B", 6}, [0x0C] = {"\\f", 2},
+    [0x0D] = {"\\r", 2}, [0x0E] = {"\\u000E", 6}, [0x0F] = {"\\u000F", 6}, [0x10] = {"\\u0010", 6},
+    [0x11] = {"\\u0011", 6}, [0x12] = {"\\u0012", 6}, [0x13] = {"\\u0013", 6}, [0x14] = {"\\u0014", 6},
+    [0x15] = {"\\u0015", 6}, [0x16] = {"\\u0016", 6}, [0x17] = {"\\u0017", 6}, [0x18] = {"\\u0018", 6},
+    [0x19] = {"\\u0019", 6}, [0x1A] = {"\\u001A", 6}, [0x1B] = {"\\u001B", 6}, [0x1C] = {"\\u001C", 6},
+    [0x1D] = {"\\u001D", 6}, [0x1E] = {"\\u001E", 6}, [0x1F] = {"\\u001F", 6},
+    ['"'] = {"\\\"", 2},
+    ['\\'] = {"\\\\", 2},
+  },
+  0,
+  {{0, 0}},
+};
+
+// U+2028 and U+2029 are valid in JSON strings but end a line in JavaScript before ES2019. Also used by js_escapes.
+static const struct code_point_escape json_line_separators[] = {
+  {0x2028U, 0x2028U, {"\\u2028", 6}},
+  {0x2029U, 0x2029U, {"\\u2029", 6}},
+};
+
+// XML 1.0 allows no control characters other than tab, line feed and carriage return, even as character references,
+// so the others are dropped (or replaced, in xml_replace_escapes), as are U+FFFE and U+FFFF
+static const struct escape_table xml_drop_escapes = {
+  "&<>\"'",
+  0x20,
+  {
+    [0x00] = {"", 0}, [0x01] = {"", 0}, [0x02] = {"", 0}, [0x03] = {"", 0}, [0x04] = {"", 0}, [0x05] = {"", 0},
+    [0x06] = {"", 0}, [0x07] = {"", 0}, [0x08] = {"", 0}, [0x0B] = {"", 0}, [0x0C] = {"", 0}, [0x0E] = {"", 0},
+    [0x0F] = {"", 0}, [0x10] = {"", 0}, [0x11] = {"", 0}, [0x12] = {"", 0}, [0x13] = {"", 0}, [0x14] = {"", 0},
+    [0x15] = {"", 0}, [0x16] = {"", 0}, [0x17] = {"", 0}, [0x18] = {"", 0}, [0x19] = {"", 0}, [0x1A] = {"", 0},
+    [0x1B] = {"", 0}, [0x1C] = {"", 0}, [0x1D] = {"", 0}, [0x1E] = {"", 0}, [0x1F] = {"", 0},
+    ['&'] = {"&amp;", 5},
+    ['<'] = {"&lt;", 4},
+    ['>'] = {"&gt;", 4},
+    ['"'] = {"&quot;", 6},
+    ['\''] = {"&apos;", 6},
+  },
+  0,
+  {{0, 0}},
+};
+
+static const struct escape_table xml_replace_escapes = {
+  "&<>\"'",
+  0x20,
+  {
+    [0x00] = {"\xEF\xBF\xBD", 3}, [0x01] = {"\xEF\xBF\xBD", 3}, [0x02] = {"\xEF\xBF\xBD", 3},
+    [0x03] = {"\xEF\xBF\xBD", 3}, [0x04] = {"\xEF\xBF\xBD", 3}, [0x05] = {"\xEF\xBF\xBD", 3},
+    [0x06] = {"\xEF\xBF\xBD", 3}, [0x07] = {"\xEF\xBF\xBD", 3}, [0x08] = {"\xEF\xBF\xBD", 3},
+    [0x0B] = {"\xEF\xBF\xBD", 3}, [0x0C] = {"\xEF\xBF\xBD", 3}, [0x0E] = {"\xEF\xBF\xBD", 3},
+    [0x0F] = {"\xEF\xBF\xBD", 3}, [0x10] = {"\xEF\xBF\xBD", 3}, [0x11] = {"\xEF\xBF\xBD", 3},
+    [0x12] = {"\xEF\xBF\xBD", 3}, [0x13] = {"\xEF\xBF\xBD", 3}, [0x14] = {"\xEF\xBF\xBD", 3},
+    [0x15] = {"\xEF\xBF\xBD", 3}, [0x16] = {"\xEF\xBF\xBD", 3}, [0x17] = {"\xEF\xBF\xBD", 3},
+    [0x18] = {"\xEF\xBF\xBD", 3}, [0x19] = {"\xEF\xBF\xBD", 3}, [0x1A] = {"\xEF\xBF\xBD", 3},
+    [0x1B] = {"\xEF\xBF\xBD", 3}, [0x1C] = {"\xEF\xBF\xBD", 3}, [0x1D] = {"\xEF\xBF\xBD", 3},
+    [0x1E] = {"\xEF\xBF\xBD", 3}, [0x1F] = {"\xEF\xBF\xBD", 3},
+    ['&'] = {"&amp;", 5},
+    ['<'] = {"&lt;", 4},
+    ['>'] = {"&gt;", 4},
+    ['"'] = {"&quot;", 6},
+    ['\''] = {"&apos;", 6},
+  },
+  0,
+  {{0, 0}},
+};
+
+static const struct code_point_escape xml_drop_code_points[] = {
+  {0xFFFEU, 0xFFFEU, {"", 0}},
+  {0xFFFFU, 0xFFFFU, {"", 0}},
+};
+
+static const struct code_point_escape xml_replace_code_points[] = {
+  {0xFFFEU, 0xFFFEU, {"\xEF\xBF\xBD", 3}},
+  {0xFFFFU, 0xFFFFU, {"\xEF\xBF\xBD", 3}},
+};
+
+// Inside single quotes every byte is literal except the quote itself, which has to be closed, escaped and reopened.
+// No argument can contain NUL, so it is replaced like an invalid sequence.
+static const struct escape_table shell_escapes = {
+  "'",
+  0x01,
+  {
+    [0x00] = {"\xEF\xBF\xBD", 3},
+    ['\''] = {"'\\''", 4},
+  },
+  0,
+  {{0, 0}},
+};
+
+// RFC 4180: a field containing a delimiter, quote or line break is quoted, and quotes inside it are doubled
+static const struct escape_table csv_escapes = {
+  ",\"\r\n",
+  0,
+  {
+    [','] = {",", 1},
+    ['"'] = {"\"\"", 2},
+    ['\r'] = {"\r", 1},
+    ['\n'] = {"\n", 1},
+  },
+  0,
+  {{0, 0}},
+};
+
+// Only the quote is special inside a quoted field
+static const struct escape_table csv_quoted_escapes = {
+  "\"",
+  0,
+  {
+    ['"'] = {"\"\"", 2},
+  },
+  0,
+  {{0, 0}},
+};
+
+// Strings embedded in an HTML <script> element must not contain </script or <!--, so < and > are escaped along with
+// the quotes and backslash, leaving the string safe inside any kind of quotes, including a template literal
+static const struct escape_table js_escapes = {
+  "\"'\\`$<>",
+  0x20,
+  {
+    [0x00] = {"\\x00", 4}, [0x01] = {"\\x01", 4}, [0x02] = {"\\x02", 4}, [0x03] = {"\\x03", 4}, [0x04] = {"\\x04", 4},
+    [0x05] = {"\\x05", 4}, [0x06] = {"\\x06", 4}, [0x07] = {"\\x07", 4}, [0x08] = {"\\b", 2}, [0x09] = {"\\t", 2},
+    [0x0A] = {"\\n", 2}, [0x0B] = {"\\v", 2}, [0x0C] = {"\\f", 2}, [0x0D] = {"\\r", 2}, [0x0E] = {"\\x0E", 4},
+    [0x0F] = {"\\x0F", 4}, [0x10] = {"\\x10", 4}, [0x11] = {"\\x11", 4}, [0x12] = {"\\x12", 4}, [0x13] = {"\\x13", 4},
+    [0x14] = {"\\x14", 4}, [0x15] = {"\\x15", 4}, [0x16] = {"\\x16", 4}, [0x17] = {"\\x17", 4}, [0x18] = {"\\x18", 4},
+    [0x19] = {"\\x19", 4}, [0x1A] = {"\\x1A", 4}, [0x1B] = {"\\x1B", 4}, [0x1C] = {"\\x1C", 4}, [0x1D] = {"\\x1D", 4},
+    [0x1E] = {"\\x1E", 4}, [0x1F] = {"\\x1F", 4},
+    ['"'] = {"\\\"", 2},
+    ['\''] = {"\\'", 2},
+    ['\\'] = {"\\\\", 2},
+    ['`'] = {"\\`", 2},
+    ['$'] = {"\\$", 2},
+    ['<'] = {"\\x3C", 4},
+    ['>'] = {"\\x3E", 4},
+  },
+  0,
+  {{0, 0}},
+};
+
+// Indexed by enum ntk_html_attribute
+static const struct escape_table* const html_attribute_escapes[] = {
+  &html_double_quoted_escapes,
+  &html_single_quoted_escapes,
+  &html_unquoted_escapes,
+};
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// A percent-encoding set: a 256-bit bitmap of the bytes which are copied unchanged. Every other byte is written as
+// %XX, except that form encoding writes a space as +.
+struct percent_set
+{
+  uint64_t allowed[4];
+  int spaceAsPlus;
+};
+
+// An escaping context: a byte table, plus the code points outside ASCII which it also escapes
+struct escape_format
+{
+  const struct escape_table* pTable;
+  const struct code_point_escape* pCodePoints;
+  size_t codePointCount;
+};
+
+// Indexed by enum ntk_escape_format
+static const struct escape_format escape_formats[] = {
+  {&html_text_escapes, NULL, 0},
+  {&html_double_quoted_escapes, NULL, 0},
+  {&json_escapes, NULL, 0},
+  {&js_escapes, json_line_separators, 2},
+  {&xml_drop_escapes, xml_drop_code_points, 2},
+  {&html_single_quoted_escapes, NULL, 0},
+  {&html_unquoted_escapes, NULL, 0},
+};
+
+// Sanitizing alone, as escape_utf8 with nothing to escape
+static const struct escape_table no_escapes = {"", 0, {{NULL, 0}}, 0, {{0, 0}}};
+static const struct escape_format sanitize_format = {&no_escapes, NULL, 0};
+
+// A custom escaping context compiled by ntk_escaper_create. It is allocated along with its code point ranges and a
+// copy of every replacement, which follow it in memory.
+struct ntk_escaper
+{
+  struct escape_table table;
+  struct escape_format format;
+};
+
+// Indexed by enum ntk_url_component
+static const struct percent_set url_component_sets[] = {
+  // unreserved, sub-delims, : and @
+  {{0x2FFF7FD200000000ULL, 0x47FFFFFE87FFFFFFULL, 0, 0}, 0},
+  // unreserved, sub-delims, : @ / and ?
+  {{0xAFFFFFD200000000ULL, 0x47FFFFFE87FFFFFFULL, 0, 0}, 0},
+  {{0xAFFFFFD200000000ULL, 0x47FFFFFE87FFFFFFULL, 0, 0}, 0},
+  // unreserved and sub-delims
+  {{0x2BFF7FD200000000ULL, 0x47FFFFFE87FFFFFEULL, 0, 0}, 0},
+  // alphanumerics and * - . _
+  {{0x03FF640000000000ULL, 0x07FFFFFE87FFFFFEULL, 0, 0}, 1},
+};
+
+// Letters of the short C escapes for control characters, indexed by byte; 0 where there is none
+static const char c_short_escapes[0x20] = {
+  ['\a'] = 'a', ['\b'] = 'b', ['\t'] = 't', ['\n'] = 'n', ['\v'] = 'v', ['\f'] = 'f', ['\r'] = 'r',
+};
+
+static size_t ascii_run(const char* pStr, size_t len);
+static size_t ascii_run_no_nul(const char* pStr, size_t len);
+static size_t utf8_code_points(const char* pStr, size_t len);
+static size_t utf8_four_byte_leads(const char* pStr, size_t len);
+static size_t utf8_nuls(const char* pStr, size_t len);
+static size_t decode_utf8(const char* pStr, size_t len, uint32_t* pCodePoint);
+static size_t decode_wtf8(const char* pStr, size_t len, uint32_t* pCodePoint);
+static size_t encode_utf8(uint32_t codePoint, char* pOut);
+static size_t encode_utf16(uint32_t codePoint, uint16_t* pOut);
+static int wtf8_convert(const char* pStr, size_t len, uint16_t* pUtf16Out, char* pUtf8Out, size_t* pOutLen);
+static size_t utf8_length_from_utf16(const uint16_t* pStr, size_t len, int swap);
+static int utf16_valid(const uint16_t* pStr, size_t len, int swap);
+static size_t utf16_to_utf8(const uint16_t* pStr, size_t len, int swap, int lossy, char* pOut);
+static int utf8_to_utf16(const char* pStr, size_t len, int swap, uint16_t* pOut, size_t* pOutLen);
+static size_t utf8_length_from_utf32(const uint32_t* pStr, size_t len, int swap);
+static int utf32_valid(const uint32_t* pStr, size_t len, int swap);
+static int utf32_to_utf8(const uint32_t* pStr, size_t len, int swap, char* pOut, size_t* pOutLen);
+static int utf8_to_utf32(const char* pStr, size_t len, int swap, uint32_t* pOut, size_t* pOutLen);
+static size_t sniff_bom(const char* pStr, size_t len, enum ntk_encoding* pEncoding);
+static void add_guess(struct ntk_encoding_guess* pGuesses, size_t* pCount, enum ntk_encoding encoding,
+                      enum ntk_charset charset, int confidence);
+static int cesu8_to_utf8(const char* pStr, size_t len, int modified, char* pOut, size_t* pOutLen);
+static int utf8_to_cesu8(const char* pStr, size_t len, int modified, char* pOut, size_t* pOutLen);
+static size_t multibyte_to_utf8(const char* pStr, size_t len, enum ntk_multibyte_charset charset, int final,
+                                int* pReplacing, char* pOut, size_t* pOutLen);
+static size_t decode_multibyte(const unsigned char* pStr, size_t len, enum ntk_multibyte_charset charset, int final,
+                               uint32_t* pCodePoint);
+static size_t decode_shift_jis(const unsigned char* pStr, size_t len, int final, uint32_t* pCodePoint);
+static size_t decode_euc_jp(const unsigned char* pStr, size_t len, int final, uint32_t* pCodePoint);
+static size_t decode_gb18030(const unsigned char* pStr, size_t len, int final, uint32_t* pCodePoint);
+static size_t decode_double_byte(const unsigned char* pStr, size_t len, const struct double_byte_table* pTable,
+                                 int final, uint32_t* pCodePoint);
+static uint32_t gb18030_code_point(size_t pointer);
+static size_t emit_multibyte(uint32_t codePoint, int* pReplacing, char* pOut);
+static uint64_t escape_specials(const struct escape_table* pTable, uint64_t word);
+static size_t escape_clean_run(const struct escape_table* pTable, const char* pStr, size_t len);
+static size_t escaped_length(const struct escape_table* pTable, const char* pStr, size_t len);
+static size_t escape(const struct escape_table* pTable, const char* pStr, size_t len, char* pOut);
+static char* escape_alloc(const struct escape_table* pTable, const char* pStr, size_t len, size_t* pBufferLen);
+static int percent_allowed(const struct percent_set* pSet, unsigned char c);
+static size_t percent_clean_run(const struct percent_set* pSet, const char* pStr, size_t len);
+static int hex_value(char c);
+static size_t url_clean_run(const char* pStr, size_t len, int plusAsSpace);
+static size_t c_clean_run(const char* pStr, size_t len);
+static size_t c_escape(const char* pStr, size_t len, size_t i, char* pOut);
+static size_t c_unescape(const char* pStr, size_t len, char* pOut, size_t* pUsed);
+static size_t escape_ascii_run(const struct escape_table* pTable, const char* pStr, size_t len);
+static size_t escape_utf8(const struct escape_table* pTable, const struct code_point_escape* pCodePoints,
+                          size_t codePointCount, const char* pStr, size_t len, int sanitize, char* pOut);
+static size_t escape_utf8_counted(const struct escape_table* pTable, const struct code_point_escape* pCodePoints,
+                                  size_t codePointCount, const char* pStr, size_t len, int sanitize, char* pOut,
+                                  size_t* pEscapes);
+static uint32_t hex_quad(const char* pStr);
+static size_t json_unescape(const char* pStr, size_t len, char* pOut, size_t* pUsed);
+static int ascii_alphanumeric(char c);
+static size_t html_clean_run(const char* pStr, size_t len);
+static size_t html_unescape(const char* pStr, size_t len, int inAttribute, char* pOut);
+static size_t html_reference(const char* pStr, size_t len, int inAttribute, uint32_t* pCodePoints);
+static const uint32_t* html_entity(const char* pName, size_t len);
+static uint32_t html_entity_hash(const char* pName, size_t len, uint32_t seed);
+static size_t shell_quote(const char* pStr, size_t len, char* pOut);
+static size_t csv_field(const char* pStr, size_t len, char* pOut);
+static size_t csv_unescape(const char* pStr, size_t len, char* pOut, size_t* pUsed);
+static size_t escape_spans(const struct escape_format* pFormat, const char* pStr, size_t len, struct ntk_span* pSpans,
+                           size_t maxSpans, size_t* pSpanCount);
+static char* escape_utf8_alloc(const struct escape_format* pFormat, const char* pStr, size_t len, size_t* pBufferLen);
+static size_t url_escape(const struct percent_set* pSet, const char* pStr, size_t len, int sanitize, char* pOut);
+
 int ntk_is_utf8(const char* pStr, size_t len)
 {
   if (pStr == NULL)
@@ -46,90 +589,4230 @@ int ntk_is_utf8(const char* pStr, size_t len)
     return 0;
   }
 
-  enum states_is_utf8 state = start;
+  enum states_is_utf8 state = start;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    // Between sequences, skip over ASCII a word at a time
+    if (state == start)
+    {
+      i += ascii_run(pStr + i, len - i);
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    state = advance(pStr[i], state);
+    if (state == invalid)
+    {
+      break;
+    }
+  }
+
+  return state == start;
+}
+
+char* ntk_sanitize_utf8(const char* pStr, size_t len, size_t* pBufferLen)
+{
+  return escape_utf8_alloc(&sanitize_format, pStr, len, pBufferLen);
+}
+
+size_t ntk_utf8_length_from_latin1(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // Every byte at or above 0x80 expands to two bytes
+  size_t ret = len;
+  size_t i = 0;
+
+  for (; len - i >= sizeof(uint64_t); i += sizeof(uint64_t))
+  {
+    ret += swar_count(swar_load(pStr + i));
+  }
+
+  for (; i < len; ++i)
+  {
+    ret += ((unsigned char)pStr[i] & (unsigned)hi1) >> 7U;
+  }
+
+  return ret;
+}
+
+int ntk_latin1_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    // Copy ASCII runs in bulk
+    size_t run = ascii_run(pStr + i, len - i);
+    memcpy(pOut + outLen, pStr + i, run);
+    outLen += run;
+    i += run;
+
+    // Expand bytes 0x80-0xFF to 0xC2/0xC3 followed by a continuation byte
+    for (; i < len && ((unsigned char)pStr[i] & (unsigned)hi1) != none; ++i)
+    {
+      const unsigned char c = (unsigned char)pStr[i];
+      pOut[outLen++] = (char)(hi2 | (c >> 6U));
+      pOut[outLen++] = (char)(hi1 | (c & 0x3FU));
+    }
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_latin1_length_from_utf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // One output byte per code point
+  return utf8_code_points(pStr, len);
+}
+
+int ntk_utf8_to_latin1(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = ascii_run(pStr + i, len - i);
+    memcpy(pOut + outLen, pStr + i, run);
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    // Only 0xC2 and 0xC3 lead bytes encode U+0080 - U+00FF. Anything else is either invalid or out of range.
+    const unsigned char lead = (unsigned char)pStr[i];
+    if ((lead & 0xFEU) != 0xC2U || i + 1 == len || ((unsigned char)pStr[i + 1] & (unsigned)hi2) != hi1)
+    {
+      return 0;
+    }
+
+    pOut[outLen++] = (char)(((lead & 0x03U) << 6U) | ((unsigned char)pStr[i + 1] & 0x3FU));
+    i += 2;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_utf16_length_from_utf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // One code unit per code point, plus one more for each four-byte sequence (which needs a surrogate pair)
+  return utf8_code_points(pStr, len) + utf8_four_byte_leads(pStr, len);
+}
+
+size_t ntk_utf32_length_from_utf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_code_points(pStr, len);
+}
+
+size_t ntk_utf8_length_from_utf16(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_length_from_utf16(pStr, len, 0);
+}
+
+size_t ntk_utf32_length_from_utf16(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // Every code unit except the low half of a surrogate pair starts a new code point
+  const uint64_t surrogateMask = 0xFC00FC00FC00FC00ULL;
+  const uint64_t lowSurrogates = 0xDC00DC00DC00DC00ULL;
+
+  size_t ret = len;
+  size_t i = 0;
+
+  for (; len - i >= swar16_lanes; i += swar16_lanes)
+  {
+    const uint64_t word = swar16_load(pStr + i);
+    ret -= swar16_lanes - swar16_count(swar16_nonzero((word & surrogateMask) ^ lowSurrogates));
+  }
+
+  for (; i < len; ++i)
+  {
+    ret -= (pStr[i] & 0xFC00U) == 0xDC00U;
+  }
+
+  return ret;
+}
+
+size_t ntk_utf8_length_from_utf32(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_length_from_utf32(pStr, len, 0);
+}
+
+size_t ntk_utf16_length_from_utf32(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  size_t ret = len;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    ret += pStr[i] >= 0x10000U;
+  }
+
+  return ret;
+}
+
+size_t ntk_utf8_length_from_charset(const char* pStr, size_t len, enum ntk_charset charset)
+{
+  if (pStr == NULL || (size_t)charset >= sizeof(charset_tables) / sizeof(charset_tables[0]))
+  {
+    return 0;
+  }
+
+  const uint16_t* pTable = charset_tables[charset];
+  size_t ret = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = ascii_run(pStr + i, len - i);
+    ret += run;
+    i += run;
+
+    for (; i < len && ((unsigned char)pStr[i] & (unsigned)hi1) != none; ++i)
+    {
+      ret += pTable[(unsigned char)pStr[i] & 0x7FU] < 0x800U ? 2 : 3;
+    }
+  }
+
+  return ret;
+}
+
+int ntk_charset_to_utf8(const char* pStr, size_t len, enum ntk_charset charset, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL || (size_t)charset >= sizeof(charset_tables) / sizeof(charset_tables[0]))
+  {
+    return 0;
+  }
+
+  const uint16_t* pTable = charset_tables[charset];
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = ascii_run(pStr + i, len - i);
+    memcpy(pOut + outLen, pStr + i, run);
+    outLen += run;
+    i += run;
+
+    for (; i < len && ((unsigned char)pStr[i] & (unsigned)hi1) != none; ++i)
+    {
+      outLen += encode_utf8(pTable[(unsigned char)pStr[i] & 0x7FU], pOut + outLen);
+    }
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_utf8_length_from_multibyte(const char* pStr, size_t len, enum ntk_multibyte_charset charset)
+{
+  if (pStr == NULL || (unsigned)charset > ntk_multibyte_euc_kr)
+  {
+    return 0;
+  }
+
+  int replacing = 0;
+  size_t ret = 0;
+  multibyte_to_utf8(pStr, len, charset, 1, &replacing, NULL, &ret);
+  return ret;
+}
+
+int ntk_multibyte_to_utf8(const char* pStr, size_t len, enum ntk_multibyte_charset charset, char* pOut,
+                          size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL || (unsigned)charset > ntk_multibyte_euc_kr)
+  {
+    return 0;
+  }
+
+  int replacing = 0;
+  multibyte_to_utf8(pStr, len, charset, 1, &replacing, pOut, pOutLen);
+  return 1;
+}
+
+void ntk_multibyte_decoder_init(struct ntk_multibyte_decoder* pDecoder, enum ntk_multibyte_charset charset)
+{
+  pDecoder->charset = charset;
+  pDecoder->pendingLen = 0;
+  pDecoder->replacing = 0;
+}
+
+int ntk_multibyte_decode(struct ntk_multibyte_decoder* pDecoder, const char* pStr, size_t len, int final, char* pOut,
+                         size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pDecoder == NULL || pOut == NULL || (pStr == NULL && len != 0) ||
+      (unsigned)pDecoder->charset > ntk_multibyte_euc_kr)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  if (pDecoder->pendingLen > 0)
+  {
+    // Finish the held sequence from a small buffer of the held bytes followed by the start of this chunk. Every
+    // sequence is at most four bytes, so the buffer always settles the held bytes unless the whole chunk fits in it.
+    unsigned char buffer[sizeof(pDecoder->pending) + 4];
+    const size_t pending = pDecoder->pendingLen;
+    const size_t taken = len < 4 ? len : 4;
+    size_t pos = 0;
+
+    memcpy(buffer, pDecoder->pending, pending);
+    if (taken > 0)
+    {
+      memcpy(buffer + pending, pStr, taken);
+    }
+
+    while (pos < pending)
+    {
+      uint32_t codePoint;
+      size_t used = decode_multibyte(buffer + pos, pending + taken - pos, pDecoder->charset, final && taken == len,
+                                     &codePoint);
+
+      if (used == 0)
+      {
+        pDecoder->pendingLen = pending + taken - pos;
+        memcpy(pDecoder->pending, buffer + pos, pDecoder->pendingLen);
+        *pOutLen = outLen;
+        return 1;
+      }
+
+      pos += used;
+      outLen += emit_multibyte(codePoint, &pDecoder->replacing, pOut + outLen);
+    }
+
+    pDecoder->pendingLen = 0;
+    i = pos - pending;
+  }
+
+  if (i < len)
+  {
+    size_t chunkLen = 0;
+    i += multibyte_to_utf8(pStr + i, len - i, pDecoder->charset, final, &pDecoder->replacing, pOut + outLen,
+                           &chunkLen);
+    outLen += chunkLen;
+  }
+
+  // pStr may be NULL when len is 0, so it is only offset and copied from when bytes remain
+  pDecoder->pendingLen = 0;
+  if (len - i > 0)
+  {
+    pDecoder->pendingLen = len - i;
+    memcpy(pDecoder->pending, pStr + i, pDecoder->pendingLen);
+  }
+
+  if (final)
+  {
+    pDecoder->replacing = 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_is_cesu8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return cesu8_to_utf8(pStr, len, 0, NULL, NULL);
+}
+
+int ntk_is_mutf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return cesu8_to_utf8(pStr, len, 1, NULL, NULL);
+}
+
+int ntk_cesu8_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return cesu8_to_utf8(pStr, len, 0, pOut, pOutLen);
+}
+
+int ntk_mutf8_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return cesu8_to_utf8(pStr, len, 1, pOut, pOutLen);
+}
+
+size_t ntk_cesu8_length_from_utf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // Each four-byte sequence becomes two three-byte surrogates
+  return len + 2 * utf8_four_byte_leads(pStr, len);
+}
+
+size_t ntk_mutf8_length_from_utf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // As CESU-8, and each NUL becomes 0xC0 0x80
+  return len + 2 * utf8_four_byte_leads(pStr, len) + utf8_nuls(pStr, len);
+}
+
+int ntk_utf8_to_cesu8(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_cesu8(pStr, len, 0, pOut, pOutLen);
+}
+
+int ntk_utf8_to_mutf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_cesu8(pStr, len, 1, pOut, pOutLen);
+}
+
+int ntk_is_wtf8(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return wtf8_convert(pStr, len, NULL, NULL, NULL);
+}
+
+int ntk_wtf8_to_utf16(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return wtf8_convert(pStr, len, pOut, NULL, pOutLen);
+}
+
+int ntk_wtf8_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return wtf8_convert(pStr, len, NULL, pOut, pOutLen);
+}
+
+size_t ntk_wtf8_length_from_utf16(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // As ntk_utf8_length_from_utf16, except that only surrogates which form a pair are shortened. Words without any
+  // surrogates are counted in bulk; the rest are checked one code unit at a time.
+
+  size_t ret = len;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    if (len - i >= swar16_lanes)
+    {
+      const uint64_t word = swar16_load(pStr + i);
+      if (swar16_count(swar16_nonzero((word & swar16_above_11_bits) ^ swar16_surrogates)) == swar16_lanes)
+      {
+        ret += swar16_count(swar16_nonzero(word & swar16_above_7_bits));
+        ret += swar16_count(swar16_nonzero(word & swar16_above_11_bits));
+        i += swar16_lanes;
+        continue;
+      }
+    }
+
+    const uint16_t c = pStr[i];
+    if ((c & 0xFC00U) == 0xD800U && i + 1 < len && (pStr[i + 1] & 0xFC00U) == 0xDC00U)
+    {
+      ret += 2;
+      i += 2;
+    }
+    else
+    {
+      ret += (c >= 0x80U) + (c >= 0x800U);
+      i += 1;
+    }
+  }
+
+  return ret;
+}
+
+int ntk_utf16_to_wtf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    // Narrow ASCII four code units at a time
+    if (len - i >= swar16_lanes && swar16_nonzero(swar16_load(pStr + i) & swar16_above_7_bits) == 0)
+    {
+      for (size_t lane = 0; lane < swar16_lanes; ++lane)
+      {
+        pOut[outLen++] = (char)pStr[i + lane];
+      }
+      i += swar16_lanes;
+      continue;
+    }
+
+    const uint16_t c = pStr[i];
+    if ((c & 0xFC00U) == 0xD800U && i + 1 < len && (pStr[i + 1] & 0xFC00U) == 0xDC00U)
+    {
+      outLen += encode_utf8(0x10000U + (((c & 0x3FFU) << 10U) | (pStr[i + 1] & 0x3FFU)), pOut + outLen);
+      i += 2;
+    }
+    else
+    {
+      // Unpaired surrogates are encoded like any other code point
+      outLen += encode_utf8(c, pOut + outLen);
+      i += 1;
+    }
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_utf8_length_from_utf16_lossy(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf16_to_utf8(pStr, len, 0, 1, NULL);
+}
+
+int ntk_utf16_to_utf8_lossy(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = utf16_to_utf8(pStr, len, 0, 1, pOut);
+  return 1;
+}
+
+int ntk_is_utf16(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf16_valid(pStr, len, 0);
+}
+
+int ntk_is_utf16le(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf16_valid(pStr, len, host_is_big_endian());
+}
+
+int ntk_is_utf16be(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf16_valid(pStr, len, !host_is_big_endian());
+}
+
+size_t ntk_utf8_length_from_utf16le(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_length_from_utf16(pStr, len, host_is_big_endian());
+}
+
+size_t ntk_utf8_length_from_utf16be(const uint16_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_length_from_utf16(pStr, len, !host_is_big_endian());
+}
+
+int ntk_utf16_to_utf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = utf16_to_utf8(pStr, len, 0, 0, pOut);
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_utf16le_to_utf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = utf16_to_utf8(pStr, len, host_is_big_endian(), 0, pOut);
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_utf16be_to_utf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = utf16_to_utf8(pStr, len, !host_is_big_endian(), 0, pOut);
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_utf8_to_utf16(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_utf16(pStr, len, 0, pOut, pOutLen);
+}
+
+int ntk_utf8_to_utf16le(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_utf16(pStr, len, host_is_big_endian(), pOut, pOutLen);
+}
+
+int ntk_utf8_to_utf16be(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_utf16(pStr, len, !host_is_big_endian(), pOut, pOutLen);
+}
+
+int ntk_is_utf32(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf32_valid(pStr, len, 0);
+}
+
+int ntk_is_utf32le(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf32_valid(pStr, len, host_is_big_endian());
+}
+
+int ntk_is_utf32be(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf32_valid(pStr, len, !host_is_big_endian());
+}
+
+size_t ntk_utf8_length_from_utf32le(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_length_from_utf32(pStr, len, host_is_big_endian());
+}
+
+size_t ntk_utf8_length_from_utf32be(const uint32_t* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_length_from_utf32(pStr, len, !host_is_big_endian());
+}
+
+int ntk_utf32_to_utf8(const uint32_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf32_to_utf8(pStr, len, 0, pOut, pOutLen);
+}
+
+int ntk_utf32le_to_utf8(const uint32_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf32_to_utf8(pStr, len, host_is_big_endian(), pOut, pOutLen);
+}
+
+int ntk_utf32be_to_utf8(const uint32_t* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf32_to_utf8(pStr, len, !host_is_big_endian(), pOut, pOutLen);
+}
+
+int ntk_utf8_to_utf32(const char* pStr, size_t len, uint32_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_utf32(pStr, len, 0, pOut, pOutLen);
+}
+
+int ntk_utf8_to_utf32le(const char* pStr, size_t len, uint32_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_utf32(pStr, len, host_is_big_endian(), pOut, pOutLen);
+}
+
+int ntk_utf8_to_utf32be(const char* pStr, size_t len, uint32_t* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_to_utf32(pStr, len, !host_is_big_endian(), pOut, pOutLen);
+}
+
+size_t ntk_sniff_encoding(const char* pStr, size_t len, struct ntk_encoding_guess* pGuesses, size_t maxGuesses)
+{
+  if (pStr == NULL || pGuesses == NULL || maxGuesses == 0)
+  {
+    return 0;
+  }
+
+  enum ntk_encoding bomEncoding;
+  size_t bomLen = sniff_bom(pStr, len, &bomEncoding);
+  if (bomLen != 0)
+  {
+    pGuesses[0].encoding = bomEncoding;
+    pGuesses[0].charset = ntk_charset_iso_8859_1;
+    pGuesses[0].confidence = 100;
+    pGuesses[0].bomLen = bomLen;
+    return 1;
+  }
+
+  const size_t sampleLen = len < sniff_sample_len ? len : sniff_sample_len;
+
+  // Masks selecting the bytes at each offset modulo 4, built from byte patterns to follow memory order on any host
+  uint64_t offsetMasks[4];
+  for (size_t offset = 0; offset < 4; ++offset)
+  {
+    unsigned char pattern[sizeof(uint64_t)] = {0};
+    pattern[offset] = (unsigned char)hi1;
+    pattern[offset + 4] = (unsigned char)hi1;
+    memcpy(&offsetMasks[offset], pattern, sizeof(uint64_t));
+  }
+
+  size_t zeros[4] = {0};
+  size_t highHistogram[128] = {0};
+  size_t highCount = 0;
+  size_t leadCount = 0;
+  size_t asciiLetters = 0;
+  int utf8Valid = 1;
+  enum states_is_utf8 state = start;
+
+  for (size_t i = 0; i < sampleLen;)
+  {
+    size_t chunk = 1;
+
+    if (sampleLen - i >= sizeof(uint64_t))
+    {
+      const uint64_t word = swar_load(pStr + i);
+      const uint64_t zeroMask = swar_zero(word);
+      for (size_t offset = 0; zeroMask != 0 && offset < 4; ++offset)
+      {
+        zeros[offset] += swar_count(zeroMask & offsetMasks[offset]);
+      }
+
+      if ((word & swar_highs) == 0 && state == start)
+      {
+        asciiLetters += swar_count(swar_ascii_letters(word));
+        i += sizeof(uint64_t);
+        continue;
+      }
+
+      chunk = sizeof(uint64_t);
+    }
+    else
+    {
+      zeros[i % 4] += pStr[i] == '\0';
+    }
+
+    for (size_t end = i + chunk; i < end; ++i)
+    {
+      const unsigned char c = (unsigned char)pStr[i];
+      if ((c & (unsigned)hi1) != none)
+      {
+        highHistogram[c & 0x7FU]++;
+        highCount++;
+        leadCount += (c & (unsigned)hi2) == hi2;
+      }
+      else
+      {
+        asciiLetters += (c | 0x20U) >= 'a' && (c | 0x20U) <= 'z';
+      }
+
+      if (utf8Valid)
+      {
+        state = advance(c, state);
+        utf8Valid = state != invalid;
+      }
+    }
+  }
+
+  // A sequence cut off by the end of the sample is not evidence against UTF-8
+  utf8Valid = utf8Valid && (state == start || sampleLen < len);
+
+  struct ntk_encoding_guess candidates[sniff_max_candidates];
+  size_t count = 0;
+
+  const size_t units32 = sampleLen / 4;
+  if (units32 != 0 && sampleLen % 4 == 0)
+  {
+    // Code points never exceed 0x10FFFF, so the top byte is always zero and the next one almost always is
+    if (zeros[3] == units32 && zeros[2] * 10 >= units32 * 9 && zeros[0] < units32)
+    {
+      add_guess(candidates, &count, ntk_encoding_utf32le, ntk_charset_iso_8859_1, (int)(70 + 25 * zeros[2] / units32));
+    }
+    if (zeros[0] == units32 && zeros[1] * 10 >= units32 * 9 && zeros[3] < units32)
+    {
+      add_guess(candidates, &count, ntk_encoding_utf32be, ntk_charset_iso_8859_1, (int)(70 + 25 * zeros[1] / units32));
+    }
+  }
+
+  const size_t units16 = sampleLen / 2;
+  if (units16 != 0 && sampleLen % 2 == 0)
+  {
+    // Text in Latin scripts leaves the high byte of most code units zero, and the low byte almost never
+    const size_t evenZeros = zeros[0] + zeros[2];
+    const size_t oddZeros = zeros[1] + zeros[3];
+    if (oddZeros * 5 >= units16 && oddZeros > evenZeros * 4)
+    {
+      add_guess(candidates, &count, ntk_encoding_utf16le, ntk_charset_iso_8859_1,
+                (int)(50 + 45 * (oddZeros - evenZeros) / units16));
+    }
+    if (evenZeros * 5 >= units16 && evenZeros > oddZeros * 4)
+    {
+      add_guess(candidates, &count, ntk_encoding_utf16be, ntk_charset_iso_8859_1,
+                (int)(50 + 45 * (evenZeros - oddZeros) / units16));
+    }
+  }
+
+  const size_t zeroCount = zeros[0] + zeros[1] + zeros[2] + zeros[3];
+  if (utf8Valid)
+  {
+    // Valid multi-byte sequences are unlikely by chance. Pure ASCII is also UTF-8, but proves little.
+    int confidence = leadCount != 0 ? 90 + (int)(leadCount < 9 ? leadCount : 9) : 80;
+    add_guess(candidates, &count, ntk_encoding_utf8, ntk_charset_iso_8859_1, zeroCount == 0 ? confidence : 20);
+  }
+
+  for (size_t i = 0; highCount != 0 && i < sizeof(sniff_charset_order) / sizeof(sniff_charset_order[0]); ++i)
+  {
+    const enum ntk_charset charset = sniff_charset_order[i];
+    long score = 0;
+    for (size_t b = 0; b < 128; ++b)
+    {
+      score += (long)highHistogram[b] * charset_weights[charset][b];
+    }
+
+    if (score > 0)
+    {
+      // Scores peak at two points per high byte. Any single-byte charset fits text that is valid UTF-8 or has NULs
+      // poorly.
+      int confidence = (int)(60 * score / (long)(2 * highCount));
+      if (utf8Valid && leadCount != 0)
+      {
+        confidence /= 4;
+      }
+      if (charset_is_latin[charset] != (highCount * 2 <= asciiLetters))
+      {
+        // Text in Latin scripts is mostly ASCII letters; anything else is mostly high bytes
+        confidence /= 2;
+      }
+      if (zeroCount != 0)
+      {
+        confidence /= 2;
+      }
+      add_guess(candidates, &count, ntk_encoding_single_byte, charset, confidence);
+    }
+  }
+
+  // Stable insertion sort, most confident first
+  for (size_t i = 1; i < count; ++i)
+  {
+    struct ntk_encoding_guess guess = candidates[i];
+    size_t j = i;
+    for (; j > 0 && candidates[j - 1].confidence < guess.confidence; --j)
+    {
+      candidates[j] = candidates[j - 1];
+    }
+    candidates[j] = guess;
+  }
+
+  if (count > maxGuesses)
+  {
+    count = maxGuesses;
+  }
+  memcpy(pGuesses, candidates, count * sizeof(candidates[0]));
+  return count;
+}
+
+size_t ntk_escape_html_length(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return escaped_length(&html_text_escapes, pStr, len);
+}
+
+int ntk_escape_html(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = escape(&html_text_escapes, pStr, len, pOut);
+  return 1;
+}
+
+char* ntk_escape_html_alloc(const char* pStr, size_t len, size_t* pBufferLen)
+{
+  return escape_alloc(&html_text_escapes, pStr, len, pBufferLen);
+}
+
+size_t ntk_escape_html_attribute_length(const char* pStr, size_t len, enum ntk_html_attribute attribute)
+{
+  if (pStr == NULL || (unsigned)attribute > ntk_html_attribute_unquoted)
+  {
+    return 0;
+  }
+
+  return escaped_length(html_attribute_escapes[attribute], pStr, len);
+}
+
+int ntk_escape_html_attribute(const char* pStr, size_t len, enum ntk_html_attribute attribute, char* pOut,
+                              size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL || (unsigned)attribute > ntk_html_attribute_unquoted)
+  {
+    return 0;
+  }
+
+  *pOutLen = escape(html_attribute_escapes[attribute], pStr, len, pOut);
+  return 1;
+}
+
+char* ntk_escape_html_attribute_alloc(const char* pStr, size_t len, enum ntk_html_attribute attribute,
+                                      size_t* pBufferLen)
+{
+  if ((unsigned)attribute > ntk_html_attribute_unquoted)
+  {
+    *pBufferLen = 0;
+    return NULL;
+  }
+
+  return escape_alloc(html_attribute_escapes[attribute], pStr, len, pBufferLen);
+}
+
+size_t ntk_escape_url_length(const char* pStr, size_t len, enum ntk_url_component component)
+{
+  if (pStr == NULL || (unsigned)component > ntk_url_form)
+  {
+    return 0;
+  }
+
+  size_t ret = url_escape(&url_component_sets[component], pStr, len, 0, NULL);
+  return ret == conversion_failed ? 0 : ret;
+}
+
+int ntk_escape_url(const char* pStr, size_t len, enum ntk_url_component component, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL || (unsigned)component > ntk_url_form)
+  {
+    return 0;
+  }
+
+  size_t outLen = url_escape(&url_component_sets[component], pStr, len, 0, pOut);
+
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_unescape_url(const char* pStr, size_t len, int plusAsSpace, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  enum states_is_utf8 state = start;
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    // Between sequences, move runs of plain ASCII at once. When decoding in place, nothing moves until the first
+    // escape.
+    if (state == start)
+    {
+      size_t run = url_clean_run(pStr + i, len - i, plusAsSpace);
+      if (pOut + outLen != pStr + i)
+      {
+        memmove(pOut + outLen, pStr + i, run);
+      }
+      outLen += run;
+      i += run;
+
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    // Decode one byte and feed it through the UTF-8 state machine before writing it
+    unsigned char c = (unsigned char)pStr[i];
+    int high;
+    int low;
+
+    if (c == '%' && len - i >= 3 && (high = hex_value(pStr[i + 1])) >= 0 && (low = hex_value(pStr[i + 2])) >= 0)
+    {
+      c = (unsigned char)(high << 4U | low);
+      i += 3;
+    }
+    else
+    {
+      if (c == '+' && plusAsSpace)
+      {
+        c = ' ';
+      }
+      ++i;
+    }
+
+    state = advance(c, state);
+    if (state == invalid)
+    {
+      return 0;
+    }
+
+    pOut[outLen++] = (char)c;
+  }
+
+  if (state != start)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_escape_c_length(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  char scratch[4];
+  size_t ret = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = c_clean_run(pStr + i, len - i);
+    ret += run;
+    i += run;
+
+    if (i < len)
+    {
+      ret += c_escape(pStr, len, i++, scratch);
+    }
+  }
+
+  return ret;
+}
+
+int ntk_escape_c(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = c_clean_run(pStr + i, len - i);
+    memcpy(pOut + outLen, pStr + i, run);
+    outLen += run;
+    i += run;
+
+    if (i < len)
+    {
+      outLen += c_escape(pStr, len, i++, pOut + outLen);
+    }
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_unescape_c(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    const char* pBackslash = memchr(pStr + i, '\\', len - i);
+    size_t run = pBackslash == NULL ? len - i : (size_t)(pBackslash - (pStr + i));
+
+    if (pOut + outLen != pStr + i)
+    {
+      memmove(pOut + outLen, pStr + i, run);
+    }
+    outLen += run;
+    i += run;
+
+    if (i < len)
+    {
+      size_t used;
+      size_t written = c_unescape(pStr + i, len - i, pOut + outLen, &used);
+
+      if (used == 0)
+      {
+        return 0;
+      }
+
+      outLen += written;
+      i += used;
+    }
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_escape_json_length(const char* pStr, size_t len, int escapeLineSeparators)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return escape_utf8(&json_escapes, json_line_separators, escapeLineSeparators ? 2 : 0, pStr, len, 1, NULL);
+}
+
+int ntk_escape_json(const char* pStr, size_t len, int escapeLineSeparators, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = escape_utf8(&json_escapes, json_line_separators, escapeLineSeparators ? 2 : 0, pStr, len, 0, pOut);
+
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_escape_json_sanitized(const char* pStr, size_t len, int escapeLineSeparators, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = escape_utf8(&json_escapes, json_line_separators, escapeLineSeparators ? 2 : 0, pStr, len, 1, pOut);
+  return 1;
+}
+
+int ntk_unescape_json(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    // The JSON escape table stops at exactly the bytes which need attention: \, ", control characters and the start
+    // of a multi-byte sequence
+    size_t run = escape_ascii_run(&json_escapes, pStr + i, len - i);
+    size_t used = 0;
+    size_t written = 0;
+
+    if (pOut + outLen != pStr + i)
+    {
+      memmove(pOut + outLen, pStr + i, run);
+    }
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    if (pStr[i] == '\\')
+    {
+      written = json_unescape(pStr + i, len - i, pOut + outLen, &used);
+    }
+    else if (((unsigned char)pStr[i] & (unsigned)hi1) != none)
+    {
+      uint32_t codePoint;
+      used = decode_utf8(pStr + i, len - i, &codePoint);
+
+      if (codePoint == invalid_code_point)
+      {
+        used = 0;
+      }
+      else
+      {
+        memmove(pOut + outLen, pStr + i, used);
+        written = used;
+      }
+    }
+
+    if (used == 0)
+    {
+      return 0;
+    }
+
+    outLen += written;
+    i += used;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_escape_xml_length(const char* pStr, size_t len, int replaceIllegal)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return replaceIllegal ? escape_utf8(&xml_replace_escapes, xml_replace_code_points, 2, pStr, len, 1, NULL)
+                        : escape_utf8(&xml_drop_escapes, xml_drop_code_points, 2, pStr, len, 1, NULL);
+}
+
+int ntk_escape_xml(const char* pStr, size_t len, int replaceIllegal, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = replaceIllegal ? escape_utf8(&xml_replace_escapes, xml_replace_code_points, 2, pStr, len, 1, pOut)
+                            : escape_utf8(&xml_drop_escapes, xml_drop_code_points, 2, pStr, len, 1, pOut);
+  return 1;
+}
+
+size_t ntk_unescape_html_length(const char* pStr, size_t len, int inAttribute)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  size_t ret = html_unescape(pStr, len, inAttribute, NULL);
+  return ret == conversion_failed ? 0 : ret;
+}
+
+int ntk_unescape_html(const char* pStr, size_t len, int inAttribute, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = html_unescape(pStr, len, inAttribute, pOut);
+
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_escape_shell_length(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return shell_quote(pStr, len, NULL);
+}
+
+int ntk_escape_shell(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = shell_quote(pStr, len, pOut);
+  return 1;
+}
+
+size_t ntk_escape_shell_args_length(const char* const* ppArgs, const size_t* pLens, size_t count)
+{
+  if (ppArgs == NULL || pLens == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (ppArgs[i] == NULL)
+    {
+      return 0;
+    }
+
+    outLen += (i > 0) + shell_quote(ppArgs[i], pLens[i], NULL);
+  }
+
+  return outLen;
+}
+
+int ntk_escape_shell_args(const char* const* ppArgs, const size_t* pLens, size_t count, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (ppArgs == NULL || pLens == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (ppArgs[i] == NULL)
+    {
+      return 0;
+    }
+
+    if (i > 0)
+    {
+      pOut[outLen++] = ' ';
+    }
+
+    outLen += shell_quote(ppArgs[i], pLens[i], pOut + outLen);
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+size_t ntk_escape_csv_length(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return csv_field(pStr, len, NULL);
+}
+
+int ntk_escape_csv(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = csv_field(pStr, len, pOut);
+  return 1;
+}
+
+size_t ntk_escape_csv_record_length(const char* const* ppFields, const size_t* pLens, size_t count)
+{
+  if (ppFields == NULL || pLens == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 2;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (ppFields[i] == NULL)
+    {
+      return 0;
+    }
+
+    outLen += (i > 0) + csv_field(ppFields[i], pLens[i], NULL);
+  }
+
+  return outLen;
+}
+
+int ntk_escape_csv_record(const char* const* ppFields, const size_t* pLens, size_t count, char* pOut,
+                          size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (ppFields == NULL || pLens == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = 0;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (ppFields[i] == NULL)
+    {
+      return 0;
+    }
+
+    if (i > 0)
+    {
+      pOut[outLen++] = ',';
+    }
+
+    outLen += csv_field(ppFields[i], pLens[i], pOut + outLen);
+  }
+
+  pOut[outLen++] = '\r';
+  pOut[outLen++] = '\n';
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_unescape_csv(const char* pStr, size_t len, char* pOut, size_t* pOutLen, size_t* pUsed)
+{
+  *pOutLen = 0;
+  *pUsed = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t used;
+  size_t outLen = csv_unescape(pStr, len, pOut, &used);
+
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  *pUsed = used;
+  return 1;
+}
+
+size_t ntk_escape_js_length(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return escape_utf8(&js_escapes, json_line_separators, 2, pStr, len, 1, NULL);
+}
+
+int ntk_escape_js(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  size_t outLen = escape_utf8(&js_escapes, json_line_separators, 2, pStr, len, 0, pOut);
+
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_escape_js_sanitized(const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  *pOutLen = escape_utf8(&js_escapes, json_line_separators, 2, pStr, len, 1, pOut);
+  return 1;
+}
+
+size_t ntk_escape_spans(const char* pStr, size_t len, enum ntk_escape_format format, struct ntk_span* pSpans,
+                        size_t maxSpans, size_t* pSpanCount)
+{
+  *pSpanCount = 0;
+
+  if (pStr == NULL || pSpans == NULL || (unsigned)format > ntk_escape_format_html_attribute_unquoted)
+  {
+    return 0;
+  }
+
+  return escape_spans(&escape_formats[format], pStr, len, pSpans, maxSpans, pSpanCount);
+}
+
+size_t ntk_escape_sanitized_length(const char* pStr, size_t len, enum ntk_escape_format format)
+{
+  if (pStr == NULL || (unsigned)format > ntk_escape_format_html_attribute_unquoted)
+  {
+    return 0;
+  }
+
+  const struct escape_format* pFormat = &escape_formats[format];
+  return escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 1, NULL);
+}
+
+int ntk_escape_sanitized(const char* pStr, size_t len, enum ntk_escape_format format, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL || (unsigned)format > ntk_escape_format_html_attribute_unquoted)
+  {
+    return 0;
+  }
+
+  const struct escape_format* pFormat = &escape_formats[format];
+  *pOutLen = escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 1, pOut);
+  return 1;
+}
+
+char* ntk_escape_sanitized_alloc(const char* pStr, size_t len, enum ntk_escape_format format, size_t* pBufferLen)
+{
+  if ((unsigned)format > ntk_escape_format_html_attribute_unquoted)
+  {
+    *pBufferLen = 0;
+    return NULL;
+  }
+
+  return escape_utf8_alloc(&escape_formats[format], pStr, len, pBufferLen);
+}
+
+size_t ntk_escape_url_sanitized_length(const char* pStr, size_t len, enum ntk_url_component component)
+{
+  if (pStr == NULL || (unsigned)component > ntk_url_form)
+  {
+    return 0;
+  }
+
+  return url_escape(&url_component_sets[component], pStr, len, 1, NULL);
+}
+
+int ntk_escape_url_sanitized(const char* pStr, size_t len, enum ntk_url_component component, char* pOut,
+                             size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pStr == NULL || pOut == NULL || (unsigned)component > ntk_url_form)
+  {
+    return 0;
+  }
+
+  *pOutLen = url_escape(&url_component_sets[component], pStr, len, 1, pOut);
+  return 1;
+}
+
+char* ntk_escape_url_sanitized_alloc(const char* pStr, size_t len, enum ntk_url_component component,
+                                     size_t* pBufferLen)
+{
+  *pBufferLen = 0;
+
+  if (pStr == NULL || len == 0 || (unsigned)component > ntk_url_form)
+  {
+    return NULL;
+  }
+
+  const struct percent_set* pSet = &url_component_sets[component];
+  char* pRet = malloc(url_escape(pSet, pStr, len, 1, NULL));
+
+  if (pRet != NULL)
+  {
+    *pBufferLen = url_escape(pSet, pStr, len, 1, pRet);
+  }
+
+  return pRet;
+}
+
+struct ntk_escaper* ntk_escaper_create(const char* const* ppAsciiEscapes,
+                                       const struct ntk_code_point_escape* pCodePoints, size_t codePointCount)
+{
+  if (pCodePoints == NULL && codePointCount != 0)
+  {
+    return NULL;
+  }
+
+  // Size the single allocation: the escaper, its ranges, then the replacement text
+  size_t textLen = 0;
+
+  for (size_t c = 0; ppAsciiEscapes != NULL && c < 0x80; ++c)
+  {
+    if (ppAsciiEscapes[c] != NULL)
+    {
+      textLen += strlen(ppAsciiEscapes[c]) + 1;
+    }
+  }
+
+  for (size_t i = 0; i < codePointCount; ++i)
+  {
+    const struct ntk_code_point_escape* pRange = &pCodePoints[i];
+
+    if (pRange->pText == NULL || pRange->first < 0x80U || pRange->first > pRange->last || pRange->last > 0x10FFFFU)
+    {
+      return NULL;
+    }
+
+    textLen += strlen(pRange->pText) + 1;
+  }
+
+  struct ntk_escaper* pEscaper =
+    malloc(sizeof(struct ntk_escaper) + codePointCount * sizeof(struct code_point_escape) + textLen);
+
+  if (pEscaper == NULL)
+  {
+    return NULL;
+  }
+
+  struct code_point_escape* pRanges = (struct code_point_escape*)(pEscaper + 1);
+  char* pText = (char*)(pRanges + codePointCount);
+
+  for (size_t c = 0; c < 0x100; ++c)
+  {
+    struct escape* pEscape = &pEscaper->table.escapes[c];
+    pEscape->pText = NULL;
+    pEscape->len = 0;
+
+    if (c < 0x80 && ppAsciiEscapes != NULL && ppAsciiEscapes[c] != NULL)
+    {
+      pEscape->len = strlen(ppAsciiEscapes[c]);
+      pEscape->pText = memcpy(pText, ppAsciiEscapes[c], pEscape->len + 1);
+      pText += pEscape->len + 1;
+    }
+  }
+
+  // Escaped control characters are found with a single compare against the highest of them
+  unsigned below = 0;
+
+  for (unsigned c = 0; c < 0x20; ++c)
+  {
+    if (pEscaper->table.escapes[c].pText != NULL)
+    {
+      below = c + 1;
+    }
+  }
+
+  // Any other escaped bytes are grouped into ranges. To bound the cost per word, the closest ranges are merged until at
+  // most escape_max_ranges remain; a byte in the gap of a merged range is then a false positive, which the byte check
+  // after the word scan skips over.
+  unsigned char ranges[0x80][2];
+  unsigned rangeCount = 0;
+
+  for (unsigned c = below; c < 0x80; ++c)
+  {
+    if (pEscaper->table.escapes[c].pText == NULL)
+    {
+      continue;
+    }
+
+    if (rangeCount > 0 && ranges[rangeCount - 1][1] == c - 1)
+    {
+      ranges[rangeCount - 1][1] = (unsigned char)c;
+    }
+    else
+    {
+      ranges[rangeCount][0] = (unsigned char)c;
+      ranges[rangeCount][1] = (unsigned char)c;
+      ++rangeCount;
+    }
+  }
+
+  while (rangeCount > escape_max_ranges)
+  {
+    unsigned closest = 0;
+
+    for (unsigned r = 1; r + 1 < rangeCount; ++r)
+    {
+      if (ranges[r + 1][0] - ranges[r][1] < ranges[closest + 1][0] - ranges[closest][1])
+      {
+        closest = r;
+      }
+    }
+
+    ranges[closest][1] = ranges[closest + 1][1];
+    memmove(ranges[closest + 1], ranges[closest + 2], (rangeCount - closest - 2) * sizeof(ranges[0]));
+    --rangeCount;
+  }
+
+  memcpy(pEscaper->table.ranges, ranges, rangeCount * sizeof(ranges[0]));
+  pEscaper->table.rangeCount = rangeCount;
+  pEscaper->table.pSpecials = "";
+  pEscaper->table.below = below;
+
+  for (size_t i = 0; i < codePointCount; ++i)
+  {
+    pRanges[i].first = pCodePoints[i].first;
+    pRanges[i].last = pCodePoints[i].last;
+    pRanges[i].escape.len = strlen(pCodePoints[i].pText);
+    pRanges[i].escape.pText = memcpy(pText, pCodePoints[i].pText, pRanges[i].escape.len + 1);
+    pText += pRanges[i].escape.len + 1;
+  }
+
+  pEscaper->format.pTable = &pEscaper->table;
+  pEscaper->format.pCodePoints = pRanges;
+  pEscaper->format.codePointCount = codePointCount;
+  return pEscaper;
+}
+
+size_t ntk_escape_custom_length(const struct ntk_escaper* pEscaper, const char* pStr, size_t len)
+{
+  if (pEscaper == NULL || pStr == NULL)
+  {
+    return 0;
+  }
+
+  const struct escape_format* pFormat = &pEscaper->format;
+  return escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 1, NULL);
+}
+
+int ntk_escape_custom(const struct ntk_escaper* pEscaper, const char* pStr, size_t len, char* pOut, size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pEscaper == NULL || pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  const struct escape_format* pFormat = &pEscaper->format;
+  size_t outLen = escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 0, pOut);
+
+  if (outLen == conversion_failed)
+  {
+    return 0;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+int ntk_escape_custom_sanitized(const struct ntk_escaper* pEscaper, const char* pStr, size_t len, char* pOut,
+                                size_t* pOutLen)
+{
+  *pOutLen = 0;
+
+  if (pEscaper == NULL || pStr == NULL || pOut == NULL)
+  {
+    return 0;
+  }
+
+  const struct escape_format* pFormat = &pEscaper->format;
+  *pOutLen = escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 1, pOut);
+  return 1;
+}
+
+size_t ntk_utf8_count_code_points(const char* pStr, size_t len)
+{
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  return utf8_code_points(pStr, len);
+}
+
+int ntk_utf8_count_code_points_validated(const char* pStr, size_t len, size_t* pCount)
+{
+  *pCount = 0;
+
+  if (pStr == NULL)
+  {
+    return 0;
+  }
+
+  // As ntk_is_utf8, counting each ASCII run whole and every other byte which is not a continuation byte
+  enum states_is_utf8 state = start;
+  size_t count = 0;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    if (state == start)
+    {
+      const size_t run = ascii_run(pStr + i, len - i);
+      count += run;
+      i += run;
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    state = advance(pStr[i], state);
+    if (state == invalid)
+    {
+      return 0;
+    }
+
+    count += ((unsigned char)pStr[i] & (unsigned)hi2) != hi1;
+  }
+
+  if (state != start)
+  {
+    return 0;
+  }
+
+  *pCount = count;
+  return 1;
+}
+
+static size_t ascii_run(const char* pStr, const size_t len)
+{
+  size_t i = 0;
+
+  while (len - i >= sizeof(uint64_t) && (swar_load(pStr + i) & swar_highs) == 0)
+  {
+    i += sizeof(uint64_t);
+  }
+
+  while (i < len && ((unsigned char)pStr[i] & (unsigned)hi1) == none)
+  {
+    ++i;
+  }
+
+  return i;
+}
+
+static size_t ascii_run_no_nul(const char* pStr, const size_t len)
+{
+  size_t i = 0;
+
+  while (len - i >= sizeof(uint64_t))
+  {
+    const uint64_t word = swar_load(pStr + i);
+    if (((word & swar_highs) | swar_zero(word)) != 0)
+    {
+      break;
+    }
+    i += sizeof(uint64_t);
+  }
+
+  while (i < len && pStr[i] != '\0' && ((unsigned char)pStr[i] & (unsigned)hi1) == none)
+  {
+    ++i;
+  }
+
+  return i;
+}
+
+static size_t utf8_code_points(const char* pStr, const size_t len)
+{
+  // Count every byte that is not a continuation byte (10xxxxxx). Four words at a time, continuation bytes are tallied
+  // per lane, and the lanes only added together every 252 words, before any of them can overflow.
+  const size_t block = 4 * sizeof(uint64_t);
+  size_t ret = len;
+  size_t i = 0;
+
+  while (len - i >= block)
+  {
+    uint64_t lanes = 0;
+
+    for (size_t blocks = 0; blocks < 0xFF / 4 && len - i >= block; ++blocks, i += block)
+    {
+      for (size_t j = 0; j < block; j += sizeof(uint64_t))
+      {
+        const uint64_t word = swar_load(pStr + i + j);
+        lanes += ((word & ~(word << 1U)) & swar_highs) >> 7U;
+      }
+    }
+
+    ret -= swar_sum(lanes);
+  }
+
+  for (; len - i >= sizeof(uint64_t); i += sizeof(uint64_t))
+  {
+    const uint64_t word = swar_load(pStr + i);
+    ret -= swar_count(word & ~(word << 1U));
+  }
+
+  for (; i < len; ++i)
+  {
+    ret -= ((unsigned char)pStr[i] & (unsigned)hi2) == hi1;
+  }
+
+  return ret;
+}
+
+static size_t utf8_four_byte_leads(const char* pStr, const size_t len)
+{
+  // Count every byte of the form 11110xxx (or above, which a validator would reject anyway)
+  size_t ret = 0;
+  size_t i = 0;
+
+  for (; len - i >= sizeof(uint64_t); i += sizeof(uint64_t))
+  {
+    const uint64_t word = swar_load(pStr + i);
+    ret += swar_count(word & (word << 1U) & (word << 2U) & (word << 3U));
+  }
+
+  for (; i < len; ++i)
+  {
+    ret += ((unsigned char)pStr[i] & (unsigned)hi4) == hi4;
+  }
+
+  return ret;
+}
+
+static size_t utf8_nuls(const char* pStr, const size_t len)
+{
+  size_t ret = 0;
+  size_t i = 0;
+
+  for (; len - i >= sizeof(uint64_t); i += sizeof(uint64_t))
+  {
+    ret += swar_count(swar_zero(swar_load(pStr + i)));
+  }
+
+  for (; i < len; ++i)
+  {
+    ret += pStr[i] == '\0';
+  }
+
+  return ret;
+}
+
+static size_t decode_utf8(const char* pStr, const size_t len, uint32_t* pCodePoint)
+{
+  // Decode the sequence at the start of pStr. On failure, the code point is invalid_code_point and the return value
+  // is the length of the invalid prefix (at least 1), so the caller can resume at the first byte that broke it.
+  const unsigned char lead = (unsigned char)pStr[0];
+  enum states_is_utf8 state = advance_start(lead);
+
+  if (state == start || state == invalid)
+  {
+    *pCodePoint = state == start ? lead : invalid_code_point;
+    return 1;
+  }
+
+  uint32_t codePoint = lead & ((lead & (unsigned)hi3) == hi2 ? 0x1FU : (lead & (unsigned)hi4) == hi3 ? 0x0FU : 0x07U);
+  size_t i = 1;
+
+  for (; state != start; ++i)
+  {
+    if (i == len || (state = advance((unsigned char)pStr[i], state)) == invalid)
+    {
+      *pCodePoint = invalid_code_point;
+      return i;
+    }
+
+    codePoint = (codePoint << 6U) | ((unsigned char)pStr[i] & 0x3FU);
+  }
+
+  *pCodePoint = codePoint;
+  return i;
+}
+
+static size_t decode_wtf8(const char* pStr, const size_t len, uint32_t* pCodePoint)
+{
+  // As decode_utf8, but also accept three-byte sequences for U+D800 - U+DFFF
+  const unsigned char* pSeq = (const unsigned char*)pStr;
+
+  if (pSeq[0] == (unsigned char)hi3_surrogate_start && len >= 3 && (pSeq[1] & (unsigned)hi3) == 0xA0U &&
+      (pSeq[2] & (unsigned)hi2) == hi1)
+  {
+    *pCodePoint = 0xD000U | ((pSeq[1] & 0x3FU) << 6U) | (pSeq[2] & 0x3FU);
+    return 3;
+  }
+
+  return decode_utf8(pStr, len, pCodePoint);
+}
+
+static size_t encode_utf8(const uint32_t codePoint, char* pOut)
+{
+  if (codePoint < 0x80U)
+  {
+    pOut[0] = (char)codePoint;
+    return 1;
+  }
+
+  if (codePoint < 0x800U)
+  {
+    pOut[0] = (char)(hi2 | (codePoint >> 6U));
+    pOut[1] = (char)(hi1 | (codePoint & 0x3FU));
+    return 2;
+  }
+
+  if (codePoint < 0x10000U)
+  {
+    pOut[0] = (char)(hi3 | (codePoint >> 12U));
+    pOut[1] = (char)(hi1 | ((codePoint >> 6U) & 0x3FU));
+    pOut[2] = (char)(hi1 | (codePoint & 0x3FU));
+    return 3;
+  }
+
+  pOut[0] = (char)(hi4 | (codePoint >> 18U));
+  pOut[1] = (char)(hi1 | ((codePoint >> 12U) & 0x3FU));
+  pOut[2] = (char)(hi1 | ((codePoint >> 6U) & 0x3FU));
+  pOut[3] = (char)(hi1 | (codePoint & 0x3FU));
+  return 4;
+}
+
+static int cesu8_to_utf8(const char* pStr, const size_t len, const int modified, char* pOut, size_t* pOutLen)
+{
+  // Validates CESU-8 (or Modified UTF-8 when modified is set), writing the UTF-8 equivalent to pOut unless it is NULL.
+  // Output is never longer than the input.
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = modified ? ascii_run_no_nul(pStr + i, len - i) : ascii_run(pStr + i, len - i);
+    if (pOut != NULL)
+    {
+      memcpy(pOut + outLen, pStr + i, run);
+    }
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    const unsigned char* pSeq = (const unsigned char*)pStr + i;
+
+    if (modified && pSeq[0] == (unsigned char)hi2_overlong1 && len - i >= 2 && pSeq[1] == (unsigned char)hi1)
+    {
+      // Modified UTF-8 encodes NUL as an overlong two-byte sequence
+      if (pOut != NULL)
+      {
+        pOut[outLen] = '\0';
+      }
+      outLen += 1;
+      i += 2;
+    }
+    else if (pSeq[0] == (unsigned char)hi3_surrogate_start && len - i >= 3 && (pSeq[1] & (unsigned)hi3) == 0xA0U &&
+             (pSeq[2] & (unsigned)hi2) == hi1)
+    {
+      // A surrogate, which must be a high surrogate immediately followed by a low surrogate
+      if ((pSeq[1] & 0xF0U) != 0xA0U || len - i < 6 || pSeq[3] != (unsigned char)hi3_surrogate_start ||
+          (pSeq[4] & 0xF0U) != 0xB0U || (pSeq[5] & (unsigned)hi2) != hi1)
+      {
+        return 0;
+      }
+
+      const uint32_t high = ((pSeq[1] & 0x0FU) << 6U) | (pSeq[2] & 0x3FU);
+      const uint32_t low = ((pSeq[4] & 0x0FU) << 6U) | (pSeq[5] & 0x3FU);
+      const uint32_t codePoint = 0x10000U + ((high << 10U) | low);
+      if (pOut != NULL)
+      {
+        encode_utf8(codePoint, pOut + outLen);
+      }
+      outLen += 4;
+      i += 6;
+    }
+    else
+    {
+      // Anything else must be a two- or three-byte UTF-8 sequence, which is copied unchanged
+      uint32_t codePoint;
+      size_t seqLen = decode_utf8(pStr + i, len - i, &codePoint);
+      if (codePoint == invalid_code_point || codePoint >= 0x10000U || (modified && codePoint == 0))
+      {
+        return 0;
+      }
+
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, pStr + i, seqLen);
+      }
+      outLen += seqLen;
+      i += seqLen;
+    }
+  }
+
+  if (pOutLen != NULL)
+  {
+    *pOutLen = outLen;
+  }
+  return 1;
+}
+
+static int utf8_to_cesu8(const char* pStr, const size_t len, const int modified, char* pOut, size_t* pOutLen)
+{
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = modified ? ascii_run_no_nul(pStr + i, len - i) : ascii_run(pStr + i, len - i);
+    memcpy(pOut + outLen, pStr + i, run);
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    if (pStr[i] == '\0')
+    {
+      pOut[outLen++] = (char)hi2_overlong1;
+      pOut[outLen++] = (char)hi1;
+      i += 1;
+      continue;
+    }
+
+    uint32_t codePoint;
+    size_t seqLen = decode_utf8(pStr + i, len - i, &codePoint);
+    if (codePoint == invalid_code_point)
+    {
+      *pOutLen = 0;
+      return 0;
+    }
+
+    if (codePoint >= 0x10000U)
+    {
+      // Split into a surrogate pair, and encode each half as a three-byte sequence
+      outLen += encode_utf8(0xD800U | ((codePoint - 0x10000U) >> 10U), pOut + outLen);
+      outLen += encode_utf8(0xDC00U | (codePoint & 0x3FFU), pOut + outLen);
+    }
+    else
+    {
+      memcpy(pOut + outLen, pStr + i, seqLen);
+      outLen += seqLen;
+    }
+    i += seqLen;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+static size_t encode_utf16(const uint32_t codePoint, uint16_t* pOut)
+{
+  if (codePoint < 0x10000U)
+  {
+    pOut[0] = (uint16_t)codePoint;
+    return 1;
+  }
+
+  pOut[0] = (uint16_t)(0xD800U | ((codePoint - 0x10000U) >> 10U));
+  pOut[1] = (uint16_t)(0xDC00U | (codePoint & 0x3FFU));
+  return 2;
+}
+
+static int wtf8_convert(const char* pStr, const size_t len, uint16_t* pUtf16Out, char* pUtf8Out, size_t* pOutLen)
+{
+  // Validates WTF-8, and writes it as UTF-16 to pUtf16Out or as UTF-8 (with surrogates replaced by U+FFFD) to
+  // pUtf8Out if either is non-NULL. WTF-8 forbids a high surrogate directly followed by a low surrogate, since that
+  // pair must be written as a four-byte sequence instead.
+  size_t outLen = 0;
+  size_t i = 0;
+  int afterHighSurrogate = 0;
+
+  while (i < len)
+  {
+    size_t run = ascii_run(pStr + i, len - i);
+    if (run != 0)
+    {
+      if (pUtf16Out != NULL)
+      {
+        for (size_t j = 0; j < run; ++j)
+        {
+          pUtf16Out[outLen + j] = (unsigned char)pStr[i + j];
+        }
+      }
+      else if (pUtf8Out != NULL)
+      {
+        memmove(pUtf8Out + outLen, pStr + i, run);
+      }
+      outLen += run;
+      i += run;
+      afterHighSurrogate = 0;
+
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    uint32_t codePoint;
+    size_t seqLen = decode_wtf8(pStr + i, len - i, &codePoint);
+    if (codePoint == invalid_code_point || (afterHighSurrogate && (codePoint & 0xFFFFFC00U) == 0xDC00U))
+    {
+      if (pOutLen != NULL)
+      {
+        *pOutLen = 0;
+      }
+      return 0;
+    }
+    afterHighSurrogate = (codePoint & 0xFFFFFC00U) == 0xD800U;
+
+    if (pUtf16Out != NULL)
+    {
+      outLen += encode_utf16(codePoint, pUtf16Out + outLen);
+    }
+    else
+    {
+      if (pUtf8Out != NULL)
+      {
+        if ((codePoint & 0xFFFFF800U) == 0xD800U)
+        {
+          encode_utf8(0xFFFDU, pUtf8Out + outLen);
+        }
+        else
+        {
+          memmove(pUtf8Out + outLen, pStr + i, seqLen);
+        }
+      }
+      outLen += seqLen;
+    }
+    i += seqLen;
+  }
+
+  if (pOutLen != NULL)
+  {
+    *pOutLen = outLen;
+  }
+  return 1;
+}
+
+static uint16_t load16(const uint16_t* p, const int swap)
+{
+  return swap ? swap16(*p) : *p;
+}
+
+static uint32_t load32(const uint32_t* p, const int swap)
+{
+  return swap ? swap32(*p) : *p;
+}
+
+// The UTF-16 and UTF-32 kernels below take a swap flag, set when the input is in the opposite byte order to the host.
+// Callers always pass a constant (or a host check the compiler folds), so each kernel is specialized per byte order and
+// the swap is applied to whole words as they are loaded rather than through a temporary buffer.
+
+static size_t utf8_length_from_utf16(const uint16_t* pStr, const size_t len, const int swap)
+{
+  // One byte per code unit, plus one at or above U+0080 and another at or above U+0800. Surrogates pass both checks,
+  // but a pair only needs four bytes, so take one back for each surrogate.
+  size_t ret = len;
+  size_t i = 0;
+
+  for (; len - i >= swar16_lanes; i += swar16_lanes)
+  {
+    const uint64_t word = swap ? swar16_swap(swar16_load(pStr + i)) : swar16_load(pStr + i);
+    ret += swar16_count(swar16_nonzero(word & swar16_above_7_bits));
+    ret += swar16_count(swar16_nonzero(word & swar16_above_11_bits));
+    ret -= swar16_lanes - swar16_count(swar16_nonzero((word & swar16_above_11_bits) ^ swar16_surrogates));
+  }
+
+  for (; i < len; ++i)
+  {
+    const uint16_t c = load16(pStr + i, swap);
+    ret += (c >= 0x80U) + (c >= 0x800U) - ((c & 0xF800U) == 0xD800U);
+  }
+
+  return ret;
+}
+
+static int utf16_valid(const uint16_t* pStr, const size_t len, const int swap)
+{
+  size_t i = 0;
+
+  while (i < len)
+  {
+    if (len - i >= swar16_lanes)
+    {
+      const uint64_t word = swap ? swar16_swap(swar16_load(pStr + i)) : swar16_load(pStr + i);
+      if (swar16_count(swar16_nonzero((word & swar16_above_11_bits) ^ swar16_surrogates)) == swar16_lanes)
+      {
+        i += swar16_lanes;
+        continue;
+      }
+    }
+
+    const uint16_t c = load16(pStr + i, swap);
+    if ((c & 0xF800U) != 0xD800U)
+    {
+      i += 1;
+    }
+    else if ((c & 0xFC00U) == 0xD800U && i + 1 < len && (load16(pStr + i + 1, swap) & 0xFC00U) == 0xDC00U)
+    {
+      i += 2;
+    }
+    else
+    {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static size_t utf16_to_utf8(const uint16_t* pStr, const size_t len, const int swap, const int lossy, char* pOut)
+{
+  // Converts to UTF-8, or only measures the output if pOut is NULL. An unpaired surrogate fails the conversion unless
+  // lossy is set, in which case each run of them becomes a single U+FFFD, as ntk_sanitize_utf8 does for runs of
+  // invalid bytes.
+  size_t outLen = 0;
+  size_t i = 0;
+  int afterReplacement = 0;
+
+  while (i < len)
+  {
+    if (len - i >= swar16_lanes)
+    {
+      const uint64_t word = swap ? swar16_swap(swar16_load(pStr + i)) : swar16_load(pStr + i);
+
+      // Four ASCII code units: narrow them directly
+      if (swar16_nonzero(word & swar16_above_7_bits) == 0)
+      {
+        for (size_t lane = 0; pOut != NULL && lane < swar16_lanes; ++lane)
+        {
+          pOut[outLen + lane] = (char)load16(pStr + i + lane, swap);
+        }
+        outLen += swar16_lanes;
+        i += swar16_lanes;
+        afterReplacement = 0;
+        continue;
+      }
+
+      // No surrogates: every code unit is a complete code point
+      if (swar16_count(swar16_nonzero((word & swar16_above_11_bits) ^ swar16_surrogates)) == swar16_lanes)
+      {
+        if (pOut != NULL)
+        {
+          for (size_t lane = 0; lane < swar16_lanes; ++lane)
+          {
+            outLen += encode_utf8(load16(pStr + i + lane, swap), pOut + outLen);
+          }
+        }
+        else
+        {
+          outLen += swar16_lanes + swar16_count(swar16_nonzero(word & swar16_above_7_bits)) +
+                    swar16_count(swar16_nonzero(word & swar16_above_11_bits));
+        }
+        i += swar16_lanes;
+        afterReplacement = 0;
+        continue;
+      }
+    }
+
+    const uint16_t c = load16(pStr + i, swap);
+    uint32_t codePoint = c;
+    size_t unitCount = 1;
+
+    if ((c & 0xF800U) == 0xD800U)
+    {
+      const uint16_t next = i + 1 < len ? load16(pStr + i + 1, swap) : 0;
+      if ((c & 0xFC00U) == 0xD800U && (next & 0xFC00U) == 0xDC00U)
+      {
+        codePoint = 0x10000U + (((c & 0x3FFU) << 10U) | (next & 0x3FFU));
+        unitCount = 2;
+      }
+      else if (!lossy)
+      {
+        return conversion_failed;
+      }
+      else
+      {
+        codePoint = invalid_code_point;
+      }
+    }
+
+    if (codePoint == invalid_code_point)
+    {
+      if (!afterReplacement)
+      {
+        if (pOut != NULL)
+        {
+          encode_utf8(0xFFFDU, pOut + outLen);
+        }
+        outLen += 3;
+      }
+      afterReplacement = 1;
+    }
+    else
+    {
+      if (pOut != NULL)
+      {
+        encode_utf8(codePoint, pOut + outLen);
+      }
+      outLen += 1 + (codePoint >= 0x80U) + (codePoint >= 0x800U) + (codePoint >= 0x10000U);
+      afterReplacement = 0;
+    }
+    i += unitCount;
+  }
+
+  return outLen;
+}
+
+static int utf8_to_utf16(const char* pStr, const size_t len, const int swap, uint16_t* pOut, size_t* pOutLen)
+{
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    // Widen ASCII runs, placing each byte directly in the half of the code unit the byte order calls for
+    size_t run = ascii_run(pStr + i, len - i);
+    for (size_t j = 0; j < run; ++j)
+    {
+      const uint16_t c = (unsigned char)pStr[i + j];
+      pOut[outLen + j] = swap ? (uint16_t)(c << 8U) : c;
+    }
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    uint32_t codePoint;
+    size_t seqLen = decode_utf8(pStr + i, len - i, &codePoint);
+    if (codePoint == invalid_code_point)
+    {
+      *pOutLen = 0;
+      return 0;
+    }
+
+    size_t unitCount = encode_utf16(codePoint, pOut + outLen);
+    for (size_t j = 0; swap && j < unitCount; ++j)
+    {
+      pOut[outLen + j] = swap16(pOut[outLen + j]);
+    }
+    outLen += unitCount;
+    i += seqLen;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+static size_t utf8_length_from_utf32(const uint32_t* pStr, const size_t len, const int swap)
+{
+  size_t ret = len;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    const uint32_t c = load32(pStr + i, swap);
+    ret += (c >= 0x80U) + (c >= 0x800U) + (c >= 0x10000U);
+  }
+
+  return ret;
+}
+
+static int utf32_valid(const uint32_t* pStr, const size_t len, const int swap)
+{
+  // Branch-free so the compiler can vectorize it; every code unit is checked even after a failure
+  int valid = 1;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    const uint32_t c = load32(pStr + i, swap);
+    valid &= c <= 0x10FFFFU && (c & 0xFFFFF800U) != 0xD800U;
+  }
+
+  return valid;
+}
+
+static int utf32_to_utf8(const uint32_t* pStr, const size_t len, const int swap, char* pOut, size_t* pOutLen)
+{
+  size_t outLen = 0;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    const uint32_t c = load32(pStr + i, swap);
+    if (c > 0x10FFFFU || (c & 0xFFFFF800U) == 0xD800U)
+    {
+      return 0;
+    }
+
+    outLen += encode_utf8(c, pOut + outLen);
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+static int utf8_to_utf32(const char* pStr, const size_t len, const int swap, uint32_t* pOut, size_t* pOutLen)
+{
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = ascii_run(pStr + i, len - i);
+    for (size_t j = 0; j < run; ++j)
+    {
+      const uint32_t c = (unsigned char)pStr[i + j];
+      pOut[outLen + j] = swap ? c << 24U : c;
+    }
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    uint32_t codePoint;
+    size_t seqLen = decode_utf8(pStr + i, len - i, &codePoint);
+    if (codePoint == invalid_code_point)
+    {
+      *pOutLen = 0;
+      return 0;
+    }
+
+    pOut[outLen++] = swap ? swap32(codePoint) : codePoint;
+    i += seqLen;
+  }
+
+  *pOutLen = outLen;
+  return 1;
+}
+
+static size_t multibyte_to_utf8(const char* pStr, const size_t len, const enum ntk_multibyte_charset charset,
+                                const int final, int* pReplacing, char* pOut, size_t* pOutLen)
+{
+  // Convert as much of pStr as possible, returning the number of bytes consumed. Unless final is set, a sequence
+  // which may continue past the end of pStr is left unconsumed. pOut may be NULL to only measure the output.
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = ascii_run(pStr + i, len - i);
+
+    if (run > 0)
+    {
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, pStr + i, run);
+      }
+
+      outLen += run;
+      i += run;
+      *pReplacing = 0;
+      continue;
+    }
+
+    uint32_t codePoint;
+    size_t used = decode_multibyte((const unsigned char*)pStr + i, len - i, charset, final, &codePoint);
+
+    if (used == 0)
+    {
+      break;
+    }
+
+    i += used;
+    outLen += emit_multibyte(codePoint, pReplacing, pOut == NULL ? NULL : pOut + outLen);
+  }
+
+  *pOutLen = outLen;
+  return i;
+}
+
+static size_t decode_multibyte(const unsigned char* pStr, const size_t len, const enum ntk_multibyte_charset charset,
+                               const int final, uint32_t* pCodePoint)
+{
+  // Decode the character at the start of pStr, returning the number of bytes it used. An invalid or unmapped
+  // sequence sets the code point to invalid_code_point; an ASCII byte which breaks a sequence is not consumed with it.
+  // If the sequence is incomplete and final is not set, 0 is returned.
+  *pCodePoint = invalid_code_point;
+
+  if (pStr[0] < 0x80U)
+  {
+    *pCodePoint = pStr[0];
+    return 1;
+  }
+
+  switch (charset)
+  {
+    case ntk_multibyte_shift_jis:
+      return decode_shift_jis(pStr, len, final, pCodePoint);
+    case ntk_multibyte_euc_jp:
+      return decode_euc_jp(pStr, len, final, pCodePoint);
+    case ntk_multibyte_gb18030:
+      return decode_gb18030(pStr, len, final, pCodePoint);
+    case ntk_multibyte_big5:
+      return decode_double_byte(pStr, len, &big5_double_byte, final, pCodePoint);
+    case ntk_multibyte_euc_kr:
+      return decode_double_byte(pStr, len, &euc_kr_double_byte, final, pCodePoint);
+  }
+
+  return 1;
+}
+
+static size_t decode_shift_jis(const unsigned char* pStr, const size_t len, const int final, uint32_t* pCodePoint)
+{
+  const unsigned lead = pStr[0];
+
+  if (lead == 0x80U)
+  {
+    *pCodePoint = lead;
+    return 1;
+  }
+
+  if (lead >= 0xA1U && lead <= 0xDFU)
+  {
+    // Halfwidth katakana
+    *pCodePoint = 0xFF61U + lead - 0xA1U;
+    return 1;
+  }
+
+  if (lead == 0xA0U || lead > 0xFCU)
+  {
+    return 1;
+  }
+
+  if (len < 2)
+  {
+    return final ? 1 : 0;
+  }
+
+  const unsigned trail = pStr[1];
+
+  if (trail >= 0x40U && trail <= 0xFCU && trail != 0x7FU)
+  {
+    // Each lead byte covers two rows of 94 characters
+    size_t pointer = (lead - (lead < 0xA0U ? 0x81U : 0xC1U)) * 188U + trail - (trail < 0x7FU ? 0x40U : 0x41U);
+
+    if (jis0208_table[pointer] != 0)
+    {
+      *pCodePoint = jis0208_table[pointer];
+      return 2;
+    }
+  }
+
+  return trail < 0x80U ? 1 : 2;
+}
+
+static size_t decode_euc_jp(const unsigned char* pStr, const size_t len, const int final, uint32_t* pCodePoint)
+{
+  const unsigned lead = pStr[0];
+
+  if (lead != 0x8EU && lead != 0x8FU && (lead < 0xA1U || lead == 0xFFU))
+  {
+    return 1;
+  }
+
+  if (len < 2)
+  {
+    return final ? 1 : 0;
+  }
+
+  const unsigned second = pStr[1];
+
+  if (second < 0xA1U || second == 0xFFU)
+  {
+    return second < 0x80U ? 1 : 2;
+  }
+
+  if (lead == 0x8EU)
+  {
+    // Halfwidth katakana
+    if (second <= 0xDFU)
+    {
+      *pCodePoint = 0xFF61U + second - 0xA1U;
+    }
+
+    return 2;
+  }
+
+  if (lead != 0x8FU)
+  {
+    uint16_t codePoint = jis0208_table[(lead - 0xA1U) * 94U + second - 0xA1U];
+    *pCodePoint = codePoint != 0 ? codePoint : invalid_code_point;
+    return 2;
+  }
+
+  // JIS X 0212
+  if (len < 3)
+  {
+    return final ? 1 : 0;
+  }
+
+  const unsigned third = pStr[2];
+
+  if (third < 0xA1U || third == 0xFFU)
+  {
+    return third < 0x80U ? 2 : 3;
+  }
+
+  uint16_t codePoint = jis0212_table[(second - 0xA1U) * 94U + third - 0xA1U];
+  *pCodePoint = codePoint != 0 ? codePoint : invalid_code_point;
+  return 3;
+}
+
+static size_t decode_gb18030(const unsigned char* pStr, const size_t len, const int final, uint32_t* pCodePoint)
+{
+  const unsigned lead = pStr[0];
+
+  if (lead == 0x80U)
+  {
+    *pCodePoint = 0x20ACU;
+    return 1;
+  }
+
+  if (lead == 0xFFU)
+  {
+    return 1;
+  }
+
+  if (len < 2)
+  {
+    return final ? 1 : 0;
+  }
+
+  if (pStr[1] < 0x30U || pStr[1] > 0x39U)
+  {
+    return decode_double_byte(pStr, len, &gb18030_double_byte, final, pCodePoint);
+  }
+
+  // Four-byte sequence: lead, digit, 0x81 - 0xFE, digit. When broken, only the lead is consumed, as the second byte
+  // is always ASCII.
+  if (len < 3)
+  {
+    return final ? 1 : 0;
+  }
+
+  if (pStr[2] < 0x81U || pStr[2] == 0xFFU)
+  {
+    return 1;
+  }
+
+  if (len < 4)
+  {
+    return final ? 1 : 0;
+  }
+
+  if (pStr[3] < 0x30U || pStr[3] > 0x39U)
+  {
+    return 1;
+  }
+
+  size_t pointer = (((lead - 0x81U) * 10U + pStr[1] - 0x30U) * 126U + pStr[2] - 0x81U) * 10U + pStr[3] - 0x30U;
+  *pCodePoint = gb18030_code_point(pointer);
+  return *pCodePoint == invalid_code_point ? 1 : 4;
+}
+
+static size_t decode_double_byte(const unsigned char* pStr, const size_t len, const struct double_byte_table* pTable,
+                                 const int final, uint32_t* pCodePoint)
+{
+  const unsigned lead = pStr[0];
+
+  if (lead < pTable->leadMin || lead > pTable->leadMax)
+  {
+    return 1;
+  }
+
+  if (len < 2)
+  {
+    return final ? 1 : 0;
+  }
+
+  const unsigned trail = pStr[1];
+
+  if (trail >= pTable->trailMin && trail <= pTable->trailMax)
+  {
+    size_t index = (lead - pTable->leadMin) * (pTable->trailMax - pTable->trailMin + 1) + trail - pTable->trailMin;
+
+    if (pTable->pTable[index] != 0)
+    {
+      *pCodePoint = pTable->pTable[index];
+      return 2;
+    }
+  }
+
+  return trail < 0x80U ? 1 : 2;
+}
+
+static uint32_t gb18030_code_point(const size_t pointer)
+{
+  if (pointer >= gb18030_supplementary_first && pointer <= gb18030_supplementary_last)
+  {
+    return 0x10000U + (uint32_t)(pointer - gb18030_supplementary_first);
+  }
+
+  if (pointer >= gb18030_bmp_pointers)
+  {
+    return invalid_code_point;
+  }
+
+  // Find the last range starting at or before pointer
+  size_t low = 0;
+  size_t high = sizeof(gb18030_ranges) / sizeof(gb18030_ranges[0]);
+
+  while (high - low > 1)
+  {
+    size_t mid = low + (high - low) / 2;
+
+    if (gb18030_ranges[mid][0] <= pointer)
+    {
+      low = mid;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  return gb18030_ranges[low][1] + (uint32_t)(pointer - gb18030_ranges[low][0]);
+}
+
+static size_t emit_multibyte(const uint32_t codePoint, int* pReplacing, char* pOut)
+{
+  // Write a decoded character, collapsing consecutive errors into one U+FFFD. pOut may be NULL to only measure.
+  char scratch[4];
+
+  if (codePoint == invalid_code_point)
+  {
+    if (*pReplacing)
+    {
+      return 0;
+    }
+
+    *pReplacing = 1;
+    return encode_utf8(0xFFFDU, pOut != NULL ? pOut : scratch);
+  }
+
+  *pReplacing = 0;
+  return encode_utf8(codePoint, pOut != NULL ? pOut : scratch);
+}
+
+static size_t sniff_bom(const char* pStr, const size_t len, enum ntk_encoding* pEncoding)
+{
+  const unsigned char* pBytes = (const unsigned char*)pStr;
+
+  // UTF-32LE must be checked before UTF-16LE, since its BOM starts with the UTF-16LE BOM
+  if (len >= 4 && pBytes[0] == 0xFFU && pBytes[1] == 0xFEU && pBytes[2] == 0 && pBytes[3] == 0)
+  {
+    *pEncoding = ntk_encoding_utf32le;
+    return 4;
+  }
+  if (len >= 4 && pBytes[0] == 0 && pBytes[1] == 0 && pBytes[2] == 0xFEU && pBytes[3] == 0xFFU)
+  {
+    *pEncoding = ntk_encoding_utf32be;
+    return 4;
+  }
+  if (len >= 3 && pBytes[0] == 0xEFU && pBytes[1] == 0xBBU && pBytes[2] == 0xBFU)
+  {
+    *pEncoding = ntk_encoding_utf8;
+    return 3;
+  }
+  if (len >= 2 && pBytes[0] == 0xFFU && pBytes[1] == 0xFEU)
+  {
+    *pEncoding = ntk_encoding_utf16le;
+    return 2;
+  }
+  if (len >= 2 && pBytes[0] == 0xFEU && pBytes[1] == 0xFFU)
+  {
+    *pEncoding = ntk_encoding_utf16be;
+    return 2;
+  }
+
+  return 0;
+}
+
+static void add_guess(struct ntk_encoding_guess* pGuesses, size_t* pCount, const enum ntk_encoding encoding,
+                      const enum ntk_charset charset, const int confidence)
+{
+  struct ntk_encoding_guess* pGuess = pGuesses + (*pCount)++;
+  pGuess->encoding = encoding;
+  pGuess->charset = charset;
+  pGuess->confidence = confidence > 100 ? 100 : confidence;
+  pGuess->bomLen = 0;
+}
+
+static uint64_t escape_specials(const struct escape_table* pTable, const uint64_t word)
+{
+  uint64_t mask = 0;
+
+  for (const char* pSpecial = pTable->pSpecials; *pSpecial != '\0'; ++pSpecial)
+  {
+    mask |= swar_zero(word ^ (swar_ones * (unsigned char)*pSpecial));
+  }
+
+  if (pTable->below != 0)
+  {
+    mask |= swar_below(word, pTable->below);
+  }
+
+  for (unsigned r = 0; r < pTable->rangeCount; ++r)
+  {
+    mask |= swar_at_least(word, pTable->ranges[r][0]) & ~swar_at_least(word, pTable->ranges[r][1] + 1U) & ~word;
+  }
+
+  return mask;
+}
+
+static size_t escape_clean_run(const struct escape_table* pTable, const char* pStr, const size_t len)
+{
+  size_t i = 0;
+
+  for (;;)
+  {
+    while (len - i >= sizeof(uint64_t) && escape_specials(pTable, swar_load(pStr + i)) == 0)
+    {
+      i += sizeof(uint64_t);
+    }
+
+    // The flagged word may hold no escape at all, if a byte below pTable->below is left alone, in which case the word
+    // scan resumes after it
+    const size_t end = len - i >= sizeof(uint64_t) ? i + sizeof(uint64_t) : len;
+
+    while (i < end && pTable->escapes[(unsigned char)pStr[i]].pText == NULL)
+    {
+      ++i;
+    }
+
+    if (i < end || i == len)
+    {
+      return i;
+    }
+  }
+}
+
+static size_t escaped_length(const struct escape_table* pTable, const char* pStr, const size_t len)
+{
+  size_t ret = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = escape_clean_run(pTable, pStr + i, len - i);
+    ret += run;
+    i += run;
+
+    for (; i < len && pTable->escapes[(unsigned char)pStr[i]].pText != NULL; ++i)
+    {
+      ret += pTable->escapes[(unsigned char)pStr[i]].len;
+    }
+  }
+
+  return ret;
+}
+
+static size_t escape(const struct escape_table* pTable, const char* pStr, const size_t len, char* pOut)
+{
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = escape_clean_run(pTable, pStr + i, len - i);
+    memcpy(pOut + outLen, pStr + i, run);
+    outLen += run;
+    i += run;
+
+    for (; i < len && pTable->escapes[(unsigned char)pStr[i]].pText != NULL; ++i)
+    {
+      const struct escape* pEscape = &pTable->escapes[(unsigned char)pStr[i]];
+      memcpy(pOut + outLen, pEscape->pText, pEscape->len);
+      outLen += pEscape->len;
+    }
+  }
+
+  return outLen;
+}
+
+static char* escape_alloc(const struct escape_table* pTable, const char* pStr, const size_t len, size_t* pBufferLen)
+{
+  // Measure first, so the output is allocated once and never grown
+  *pBufferLen = 0;
+
+  if (pStr == NULL || len == 0)
+  {
+    return NULL;
+  }
+
+  size_t outLen = escaped_length(pTable, pStr, len);
+  char* pRet = malloc(outLen);
+
+  if (pRet != NULL)
+  {
+    *pBufferLen = escape(pTable, pStr, len, pRet);
+  }
+
+  return pRet;
+}
+
+static int percent_allowed(const struct percent_set* pSet, const unsigned char c)
+{
+  return (int)((pSet->allowed[c >> 6U] >> (c & 0x3FU)) & 1U);
+}
+
+static size_t percent_clean_run(const struct percent_set* pSet, const char* pStr, const size_t len)
+{
+  // Every set allows the ASCII alphanumerics, so a word of nothing else is skipped without consulting the bitmap
+  size_t i = 0;
+
+  while (len - i >= sizeof(uint64_t))
+  {
+    const uint64_t word = swar_load(pStr + i);
+    if ((swar_ascii_letters(word) | swar_ascii_digits(word)) != swar_highs)
+    {
+      break;
+    }
+    i += sizeof(uint64_t);
+  }
+
+  while (i < len && percent_allowed(pSet, (unsigned char)pStr[i]))
+  {
+    ++i;
+  }
+
+  return i;
+}
+
+static int hex_value(const char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+
+  if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+  {
+    return (c | 0x20) - 'a' + 10;
+  }
+
+  return -1;
+}
+
+static size_t url_clean_run(const char* pStr, const size_t len, const int plusAsSpace)
+{
+  // Find the first byte which is not ASCII, a %, or (when it means a space) a +
+  const uint64_t plus = plusAsSpace ? swar_ones * '+' : swar_ones * '%';
+  size_t i = 0;
+
+  while (len - i >= sizeof(uint64_t))
+  {
+    const uint64_t word = swar_load(pStr + i);
+    if (((word & swar_highs) | swar_zero(word ^ (swar_ones * '%')) | swar_zero(word ^ plus)) != 0)
+    {
+      break;
+    }
+    i += sizeof(uint64_t);
+  }
+
+  while (i < len && ((unsigned char)pStr[i] & (unsigned)hi1) == none && pStr[i] != '%' &&
+         (pStr[i] != '+' || !plusAsSpace))
+  {
+    ++i;
+  }
+
+  return i;
+}
+
+static size_t c_clean_run(const char* pStr, const size_t len)
+{
+  // Printable ASCII other than " \ and ?
+  size_t i = 0;
+
+  while (len - i >= sizeof(uint64_t))
+  {
+    const uint64_t word = swar_load(pStr + i);
+    const uint64_t specials = swar_zero(word ^ (swar_ones * '"')) | swar_zero(word ^ (swar_ones * '\\')) |
+                              swar_zero(word ^ (swar_ones * '?')) | swar_zero(word ^ (swar_ones * 0x7FU));
+    if (((word & swar_highs) | swar_below(word, 0x20) | specials) != 0)
+    {
+      break;
+    }
+    i += sizeof(uint64_t);
+  }
+
+  while (i < len && pStr[i] >= 0x20 && pStr[i] < 0x7F && pStr[i] != '"' && pStr[i] != '\\' && pStr[i] != '?')
+  {
+    ++i;
+  }
+
+  return i;
+}
+
+static size_t c_escape(const char* pStr, const size_t len, const size_t i, char* pOut)
+{
+  // Write the escape for pStr[i], which c_clean_run stopped at, and return its length
+  const unsigned char c = (unsigned char)pStr[i];
+
+  if (c == '?')
+  {
+    if (i == 0 || pStr[i - 1] != '?')
+    {
+      pOut[0] = '?';
+      return 1;
+    }
+  }
+
+  if (c == '"' || c == '\\' || c == '?')
+  {
+    pOut[0] = '\\';
+    pOut[1] = (char)c;
+    return 2;
+  }
+
+  if (c < 0x20 && c_short_escapes[c] != 0)
+  {
+    pOut[0] = '\\';
+    pOut[1] = c_short_escapes[c];
+    return 2;
+  }
+
+  pOut[0] = '\\';
+
+  if (i + 1 < len && hex_value(pStr[i + 1]) >= 0)
+  {
+    pOut[1] = (char)('0' + (c >> 6U));
+    pOut[2] = (char)('0' + ((c >> 3U) & 7U));
+    pOut[3] = (char)('0' + (c & 7U));
+  }
+  else
+  {
+    pOut[1] = 'x';
+    pOut[2] = hex_digits[c >> 4U];
+    pOut[3] = hex_digits[c & 0x0FU];
+  }
+
+  return 4;
+}
+
+static size_t c_unescape(const char* pStr, const size_t len, char* pOut, size_t* pUsed)
+{
+  // Decode the escape starting with the backslash at pStr[0]. On failure, *pUsed is 0. The escape is read before
+  // anything is written, as pOut may overlap it.
+  *pUsed = 0;
+
+  if (len < 2)
+  {
+    return 0;
+  }
+
+  static const char simple[] = "abfnrtv\\'\"?";
+  static const char simpleValues[] = "\a\b\f\n\r\t\v\\'\"?";
+  const char* pSimple = strchr(simple, pStr[1]);
+
+  if (pSimple != NULL && pStr[1] != '\0')
+  {
+    pOut[0] = simpleValues[pSimple - simple];
+    *pUsed = 2;
+    return 1;
+  }
+
+  if (pStr[1] >= '0' && pStr[1] <= '7')
+  {
+    unsigned value = 0;
+    size_t i = 1;
+
+    for (; i < len && i < 4 && pStr[i] >= '0' && pStr[i] <= '7'; ++i)
+    {
+      value = value << 3U | (unsigned)(pStr[i] - '0');
+    }
+
+    if (value > 0xFFU)
+    {
+      return 0;
+    }
+
+    pOut[0] = (char)value;
+    *pUsed = i;
+    return 1;
+  }
+
+  if (pStr[1] == 'x')
+  {
+    unsigned value = 0;
+    size_t i = 2;
+    int digit;
+
+    for (; i < len && (digit = hex_value(pStr[i])) >= 0; ++i)
+    {
+      value = value << 4U | (unsigned)digit;
+      if (value > 0xFFU)
+      {
+        return 0;
+      }
+    }
+
+    if (i == 2)
+    {
+      return 0;
+    }
+
+    pOut[0] = (char)value;
+    *pUsed = i;
+    return 1;
+  }
+
+  if (pStr[1] == 'u' || pStr[1] == 'U')
+  {
+    const size_t digits = pStr[1] == 'u' ? 4 : 8;
+    uint32_t codePoint = 0;
+
+    if (len < 2 + digits)
+    {
+      return 0;
+    }
+
+    for (size_t i = 2; i < 2 + digits; ++i)
+    {
+      int digit = hex_value(pStr[i]);
+      if (digit < 0)
+      {
+        return 0;
+      }
+      codePoint = codePoint << 4U | (uint32_t)digit;
+    }
+
+    if (codePoint > 0x10FFFFU || (codePoint >= 0xD800U && codePoint <= 0xDFFFU))
+    {
+      return 0;
+    }
+
+    *pUsed = 2 + digits;
+    return encode_utf8(codePoint, pOut);
+  }
+
+  return 0;
+}
+
+static size_t escape_ascii_run(const struct escape_table* pTable, const char* pStr, const size_t len)
+{
+  // As escape_clean_run, but also stopping at the first byte of a multi-byte sequence
+  size_t i = 0;
+
+  for (;;)
+  {
+    while (len - i >= sizeof(uint64_t))
+    {
+      const uint64_t word = swar_load(pStr + i);
+      if (((word & swar_highs) | escape_specials(pTable, word)) != 0)
+      {
+        break;
+      }
+      i += sizeof(uint64_t);
+    }
+
+    const size_t end = len - i >= sizeof(uint64_t) ? i + sizeof(uint64_t) : len;
+
+    while (i < end && ((unsigned char)pStr[i] & (unsigned)hi1) == none &&
+           pTable->escapes[(unsigned char)pStr[i]].pText == NULL)
+    {
+      ++i;
+    }
+
+    if (i < end || i == len)
+    {
+      return i;
+    }
+  }
+}
+
+static size_t escape_utf8(const struct escape_table* pTable, const struct code_point_escape* pCodePoints,
+                          const size_t codePointCount, const char* pStr, const size_t len, const int sanitize,
+                          char* pOut)
+{
+  // Escape pStr while validating it as UTF-8, returning the output length. Non-ASCII code points listed in
+  // pCodePoints are escaped too. If sanitize is set, each run of invalid sequences becomes one U+FFFD; otherwise,
+  // conversion_failed is returned at the first. pOut may be NULL to only measure the output.
+  size_t escapes;
+  return escape_utf8_counted(pTable, pCodePoints, codePointCount, pStr, len, sanitize, pOut, &escapes);
+}
+
+static size_t escape_utf8_counted(const struct escape_table* pTable, const struct code_point_escape* pCodePoints,
+                                  const size_t codePointCount, const char* pStr, const size_t len, const int sanitize,
+                                  char* pOut, size_t* pEscapes)
+{
+  // As escape_utf8, also counting the characters escaped (not the invalid sequences replaced) in *pEscapes
+  size_t outLen = 0;
+  *pEscapes = 0;
+  size_t i = 0;
+  int replacing = 0;
+
+  while (i < len)
+  {
+    size_t run = escape_ascii_run(pTable, pStr + i, len - i);
+
+    if (run > 0)
+    {
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, pStr + i, run);
+      }
+
+      outLen += run;
+      i += run;
+      replacing = 0;
+
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    const unsigned char c = (unsigned char)pStr[i];
+    const struct escape* pEscape = NULL;
+    size_t seqLen = 1;
+
+    if ((c & (unsigned)hi1) == none)
+    {
+      pEscape = &pTable->escapes[c];
+    }
+    else
+    {
+      uint32_t codePoint;
+      seqLen = decode_utf8(pStr + i, len - i, &codePoint);
+
+      if (codePoint == invalid_code_point)
+      {
+        if (!sanitize)
+        {
+          return conversion_failed;
+        }
+
+        i += seqLen;
+
+        if (replacing)
+        {
+          continue;
+        }
+
+        replacing = 1;
+        pEscape = &replacement_escape;
+        seqLen = 0;
+      }
+
+      for (size_t j = 0; j < codePointCount && pEscape == NULL; ++j)
+      {
+        if (codePoint >= pCodePoints[j].first && codePoint <= pCodePoints[j].last)
+        {
+          pEscape = &pCodePoints[j].escape;
+        }
+      }
+    }
+
+    if (pEscape == NULL)
+    {
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, pStr + i, seqLen);
+      }
+
+      outLen += seqLen;
+    }
+    else
+    {
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, pEscape->pText, pEscape->len);
+      }
+
+      outLen += pEscape->len;
+    }
+
+    if (seqLen > 0)
+    {
+      replacing = 0;
+      *pEscapes += pEscape != NULL;
+    }
+
+    i += seqLen;
+  }
+
+  return outLen;
+}
+
+static uint32_t hex_quad(const char* pStr)
+{
+  // Parse exactly four hexadecimal digits, or return invalid_code_point
+  uint32_t ret = 0;
+
+  for (size_t i = 0; i < 4; ++i)
+  {
+    int digit = hex_value(pStr[i]);
+    if (digit < 0)
+    {
+      return invalid_code_point;
+    }
+    ret = ret << 4U | (uint32_t)digit;
+  }
+
+  return ret;
+}
+
+static size_t json_unescape(const char* pStr, const size_t len, char* pOut, size_t* pUsed)
+{
+  // Decode the escape starting with the backslash at pStr[0]. On failure, *pUsed is 0. The escape is read before
+  // anything is written, as pOut may overlap it.
+  *pUsed = 0;
+
+  if (len < 2)
+  {
+    return 0;
+  }
+
+  static const char simple[] = "\"\\/bfnrt";
+  static const char simpleValues[] = "\"\\/\b\f\n\r\t";
+  const char* pSimple = strchr(simple, pStr[1]);
+
+  if (pSimple != NULL && pStr[1] != '\0')
+  {
+    pOut[0] = simpleValues[pSimple - simple];
+    *pUsed = 2;
+    return 1;
+  }
+
+  if (pStr[1] != 'u' || len < 6)
+  {
+    return 0;
+  }
+
+  uint32_t codePoint = hex_quad(pStr + 2);
+  size_t used = 6;
+
+  if (codePoint >= 0xD800U && codePoint <= 0xDBFFU)
+  {
+    // A high surrogate must be followed by an escaped low surrogate
+    uint32_t low = len >= 12 && pStr[6] == '\\' && pStr[7] == 'u' ? hex_quad(pStr + 8) : invalid_code_point;
+
+    if (low < 0xDC00U || low > 0xDFFFU)
+    {
+      return 0;
+    }
+
+    codePoint = 0x10000U + ((codePoint - 0xD800U) << 10U) + (low - 0xDC00U);
+    used = 12;
+  }
+  else if (codePoint == invalid_code_point || (codePoint >= 0xDC00U && codePoint <= 0xDFFFU))
+  {
+    return 0;
+  }
+
+  *pUsed = used;
+  return encode_utf8(codePoint, pOut);
+}
 
-  for (size_t i = 0; i < len; ++i)
+static int ascii_alphanumeric(const char c)
+{
+  return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+}
+
+static size_t html_clean_run(const char* pStr, const size_t len)
+{
+  // ASCII other than &
+  size_t i = 0;
+
+  while (len - i >= sizeof(uint64_t))
   {
-    state = advance(pStr[i], state);
-    if (state == invalid)
+    const uint64_t word = swar_load(pStr + i);
+    if (((word & swar_highs) | swar_zero(word ^ (swar_ones * '&'))) != 0)
     {
       break;
     }
+    i += sizeof(uint64_t);
   }
 
-  return state == start;
+  while (i < len && ((unsigned char)pStr[i] & (unsigned)hi1) == none && pStr[i] != '&')
+  {
+    ++i;
+  }
+
+  return i;
 }
 
-char* ntk_sanitize_utf8(const char* pStr, size_t len, size_t* pBufferLen)
+static size_t html_unescape(const char* pStr, const size_t len, const int inAttribute, char* pOut)
 {
-  if (pStr == NULL || len == 0)
+  // Decode pStr, returning the output length, or conversion_failed if the input is not valid UTF-8 or, when decoding
+  // in place, the output would overtake the input. pOut may be NULL to only measure the output.
+  size_t outLen = 0;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    size_t run = html_clean_run(pStr + i, len - i);
+
+    if (pOut != NULL && pOut + outLen != pStr + i)
+    {
+      memmove(pOut + outLen, pStr + i, run);
+    }
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      break;
+    }
+
+    if (pStr[i] == '&')
+    {
+      uint32_t codePoints[2];
+      size_t used = html_reference(pStr + i, len - i, inAttribute, codePoints);
+
+      if (used == 0)
+      {
+        if (pOut != NULL)
+        {
+          pOut[outLen] = '&';
+        }
+        ++outLen;
+        ++i;
+        continue;
+      }
+
+      char decoded[8];
+      size_t written = encode_utf8(codePoints[0], decoded);
+
+      if (codePoints[1] != 0)
+      {
+        written += encode_utf8(codePoints[1], decoded + written);
+      }
+
+      if (pOut == pStr && outLen + written > i + used)
+      {
+        return conversion_failed;
+      }
+
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, decoded, written);
+      }
+      outLen += written;
+      i += used;
+    }
+    else
+    {
+      uint32_t codePoint;
+      size_t used = decode_utf8(pStr + i, len - i, &codePoint);
+
+      if (codePoint == invalid_code_point)
+      {
+        return conversion_failed;
+      }
+
+      if (pOut != NULL)
+      {
+        memmove(pOut + outLen, pStr + i, used);
+      }
+      outLen += used;
+      i += used;
+    }
+  }
+
+  return outLen;
+}
+
+static size_t html_reference(const char* pStr, const size_t len, const int inAttribute, uint32_t* pCodePoints)
+{
+  // Decode the character reference starting with the & at pStr[0], returning its length, or 0 if there is none
+  pCodePoints[1] = 0;
+
+  if (len > 1 && pStr[1] == '#')
+  {
+    const int hex = len > 2 && (pStr[2] | 0x20) == 'x';
+    const size_t digitsStart = hex ? 3 : 2;
+    uint32_t value = 0;
+    size_t i = digitsStart;
+
+    for (; i < len; ++i)
+    {
+      int digit = hex ? hex_value(pStr[i]) : pStr[i] >= '0' && pStr[i] <= '9' ? pStr[i] - '0' : -1;
+      if (digit < 0)
+      {
+        break;
+      }
+
+      // Saturate just above the last code point, so long references cannot wrap around
+      value = value * (hex ? 16U : 10U) + (uint32_t)digit;
+      if (value > 0x10FFFFU)
+      {
+        value = 0x110000U;
+      }
+    }
+
+    if (i == digitsStart)
+    {
+      return 0;
+    }
+
+    if (i < len && pStr[i] == ';')
+    {
+      ++i;
+    }
+
+    if (value == 0 || value > 0x10FFFFU || (value >= 0xD800U && value <= 0xDFFFU))
+    {
+      value = 0xFFFDU;
+    }
+    else if (value >= 0x80U && value <= 0x9FU && charset_tables[ntk_charset_windows_1252][value - 0x80U] != 0xFFFDU)
+    {
+      value = charset_tables[ntk_charset_windows_1252][value - 0x80U];
+    }
+
+    pCodePoints[0] = value;
+    return i;
+  }
+
+  size_t nameLen = 0;
+
+  while (1 + nameLen < len && nameLen < html_entity_max_name && ascii_alphanumeric(pStr[1 + nameLen]))
+  {
+    ++nameLen;
+  }
+
+  if (nameLen == 0)
+  {
+    return 0;
+  }
+
+  // A name ending in a semicolon can only match the whole alphanumeric run; failing that, look for the longest legacy
+  // name which omits it
+  const uint32_t* pEntity;
+
+  if (1 + nameLen < len && pStr[1 + nameLen] == ';' && (pEntity = html_entity(pStr + 1, nameLen + 1)) != NULL)
+  {
+    memcpy(pCodePoints, pEntity, 2 * sizeof(uint32_t));
+    return nameLen + 2;
+  }
+
+  for (size_t legacyLen = nameLen < html_entity_max_legacy_name ? nameLen : html_entity_max_legacy_name;
+       legacyLen >= 2; --legacyLen)
+  {
+    if ((pEntity = html_entity(pStr + 1, legacyLen)) != NULL)
+    {
+      const size_t end = 1 + legacyLen;
+
+      if (inAttribute && end < len && (pStr[end] == '=' || ascii_alphanumeric(pStr[end])))
+      {
+        return 0;
+      }
+
+      memcpy(pCodePoints, pEntity, 2 * sizeof(uint32_t));
+      return end;
+    }
+  }
+
+  return 0;
+}
+
+static const uint32_t* html_entity(const char* pName, const size_t len)
+{
+  // Look up a name in the perfect hash generated by tools/gen_html_entities.py
+  const uint32_t bucket = html_entity_hash(pName, len, 0) % html_entity_buckets;
+  const uint32_t slot = html_entity_hash(pName, len, html_entity_displacements[bucket]) % html_entity_count;
+  const char* pCandidate = html_entity_names[slot];
+
+  if (strlen(pCandidate) != len || memcmp(pCandidate, pName, len) != 0)
   {
-    *pBufferLen = 0;
     return NULL;
   }
 
-  char* pRet = malloc(len);
-  *pBufferLen = len;
+  return html_entity_code_points[slot];
+}
 
-  enum states_is_utf8 state = start;
-  int invalidFlag = 0;
-  size_t validStart = 0;
-  size_t sanitizedLen = 0;
+static uint32_t html_entity_hash(const char* pName, const size_t len, const uint32_t seed)
+{
+  // 32-bit FNV-1a, with the starting value varied by seed
+  uint32_t hash = 0x811C9DC5U ^ (seed * 0x9E3779B9U);
 
   for (size_t i = 0; i < len; ++i)
   {
-    state = advance(pStr[i], state);
-    if (state == invalid && !invalidFlag)
+    hash = (hash ^ (unsigned char)pName[i]) * 0x01000193U;
+  }
+
+  return hash;
+}
+
+static size_t shell_quote(const char* pStr, const size_t len, char* pOut)
+{
+  // Quote and sanitize pStr, returning the output length. pOut may be NULL to only measure the output.
+  if (pOut == NULL)
+  {
+    return escape_utf8(&shell_escapes, NULL, 0, pStr, len, 1, NULL) + 2;
+  }
+
+  pOut[0] = '\'';
+  size_t outLen = 1 + escape_utf8(&shell_escapes, NULL, 0, pStr, len, 1, pOut + 1);
+  pOut[outLen] = '\'';
+  return outLen + 1;
+}
+
+static size_t csv_field(const char* pStr, const size_t len, char* pOut)
+{
+  // Sanitize and escape pStr, returning the output length. pOut may be NULL to only measure the output. Whether the
+  // field needs quotes is only known once it has been escaped, so it is shifted along to make room for them if so.
+  size_t escapes;
+  const size_t outLen = escape_utf8_counted(&csv_escapes, NULL, 0, pStr, len, 1, pOut, &escapes);
+
+  if (escapes == 0)
+  {
+    return outLen;
+  }
+
+  if (pOut != NULL)
+  {
+    memmove(pOut + 1, pOut, outLen);
+    pOut[0] = '"';
+    pOut[outLen + 1] = '"';
+  }
+
+  return outLen + 2;
+}
+
+static size_t csv_unescape(const char* pStr, const size_t len, char* pOut, size_t* pUsed)
+{
+  // Unquote the field at the start of pStr into pOut, which may be pStr, returning the output length, or
+  // conversion_failed if the field is malformed
+  if (len == 0 || pStr[0] != '"')
+  {
+    const size_t run = escape_clean_run(&csv_escapes, pStr, len);
+
+    if (run < len && pStr[run] == '"')
+    {
+      return conversion_failed;
+    }
+
+    if (pOut != pStr)
+    {
+      memmove(pOut, pStr, run);
+    }
+
+    *pUsed = run;
+    return run;
+  }
+
+  size_t outLen = 0;
+  size_t i = 1;
+
+  for (;;)
+  {
+    const size_t run = escape_clean_run(&csv_quoted_escapes, pStr + i, len - i);
+
+    if (pOut + outLen != pStr + i)
+    {
+      memmove(pOut + outLen, pStr + i, run);
+    }
+    outLen += run;
+    i += run;
+
+    if (i == len)
+    {
+      return conversion_failed;
+    }
+
+    if (i + 1 == len || pStr[i + 1] != '"')
+    {
+      break;
+    }
+
+    pOut[outLen++] = '"';
+    i += 2;
+  }
+
+  // Step over the closing quote, which must end the field
+  ++i;
+
+  if (i < len && pStr[i] != ',' && pStr[i] != '\r' && pStr[i] != '\n')
+  {
+    return conversion_failed;
+  }
+
+  *pUsed = i;
+  return outLen;
+}
+
+static size_t escape_spans(const struct escape_format* pFormat, const char* pStr, const size_t len,
+                           struct ntk_span* pSpans, const size_t maxSpans, size_t* pSpanCount)
+{
+  // As escape_utf8 when sanitizing, but rather than copying the clean data since the last escape (pStr + cleanStart),
+  // point a span at it. Returns the number of input bytes covered before the spans ran out.
+  const struct escape_table* pTable = pFormat->pTable;
+  size_t spanCount = 0;
+  size_t cleanStart = 0;
+  size_t i = 0;
+  int replacing = 0;
+
+  while (i < len)
+  {
+    size_t run = escape_ascii_run(pTable, pStr + i, len - i);
+
+    if (run > 0)
+    {
+      i += run;
+      replacing = 0;
+
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    const unsigned char c = (unsigned char)pStr[i];
+    const struct escape* pEscape = NULL;
+    size_t seqLen = 1;
+
+    if ((c & (unsigned)hi1) == none)
     {
-      invalidFlag = 1;
+      pEscape = &pTable->escapes[c];
+    }
+    else
+    {
+      uint32_t codePoint;
+      seqLen = decode_utf8(pStr + i, len - i, &codePoint);
 
-      // Copy last-seen good data
-      if (*pBufferLen - sanitizedLen < i - validStart + 3) // +3 for U+FFFD
+      if (codePoint == invalid_code_point)
       {
-        *pBufferLen = sanitizedLen + i - validStart + 3;
-        char* pNewBuf = realloc(pRet, *pBufferLen);
-        if (pNewBuf != NULL)
+        if (replacing)
         {
-          pRet = pNewBuf;
+          // Already covered by the U+FFFD for the start of the run
+          i += seqLen;
+          cleanStart = i;
+          continue;
         }
-        else // realloc failed... give up and return a NULL buffer
+
+        pEscape = &replacement_escape;
+      }
+
+      for (size_t j = 0; j < pFormat->codePointCount && pEscape == NULL; ++j)
+      {
+        if (codePoint >= pFormat->pCodePoints[j].first && codePoint <= pFormat->pCodePoints[j].last)
         {
-          free(pRet);
-          pRet = NULL;
-          *pBufferLen = 0;
-          return NULL;
+          pEscape = &pFormat->pCodePoints[j].escape;
         }
       }
+    }
+
+    if (pEscape == NULL)
+    {
+      i += seqLen;
+      replacing = 0;
+      continue;
+    }
 
-      memcpy(pRet + sanitizedLen, pStr + validStart, i - validStart);
-      sanitizedLen += i - validStart;
+    if (i > cleanStart)
+    {
+      if (spanCount == maxSpans)
+      {
+        break;
+      }
 
-      // Insert U+FFFD
-      pRet[sanitizedLen++] = '\xEF';
-      pRet[sanitizedLen++] = '\xBF';
-      pRet[sanitizedLen++] = '\xBD';
+      pSpans[spanCount].pData = pStr + cleanStart;
+      pSpans[spanCount].len = i - cleanStart;
+      ++spanCount;
+      cleanStart = i;
     }
-    else if (state != invalid && invalidFlag)
+
+    if (pEscape->len > 0)
     {
-      invalidFlag = 0;
-      validStart = i;
+      if (spanCount == maxSpans)
+      {
+        break;
+      }
+
+      pSpans[spanCount].pData = pEscape->pText;
+      pSpans[spanCount].len = pEscape->len;
+      ++spanCount;
     }
+
+    replacing = pEscape == &replacement_escape;
+    i += seqLen;
+    cleanStart = i;
+  }
+
+  if (i == len && len > cleanStart && spanCount < maxSpans)
+  {
+    pSpans[spanCount].pData = pStr + cleanStart;
+    pSpans[spanCount].len = len - cleanStart;
+    ++spanCount;
+    cleanStart = len;
+  }
+
+  *pSpanCount = spanCount;
+  return cleanStart;
+}
+
+static char* escape_utf8_alloc(const struct escape_format* pFormat, const char* pStr, const size_t len,
+                               size_t* pBufferLen)
+{
+  // As escape_alloc, sanitizing as it escapes
+  *pBufferLen = 0;
+
+  if (pStr == NULL || len == 0)
+  {
+    return NULL;
+  }
+
+  size_t outLen = escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 1, NULL);
+  char* pRet = malloc(outLen);
+
+  if (pRet != NULL)
+  {
+    *pBufferLen = escape_utf8(pFormat->pTable, pFormat->pCodePoints, pFormat->codePointCount, pStr, len, 1, pRet);
   }
 
-  if (!invalidFlag && validStart < len)
+  return pRet;
+}
+
+static size_t url_escape(const struct percent_set* pSet, const char* pStr, const size_t len, const int sanitize,
+                         char* pOut)
+{
+  // Percent-encode pStr while validating it as UTF-8, returning the output length. If sanitize is set, each run of
+  // invalid sequences is encoded as one U+FFFD; otherwise, conversion_failed is returned at the first. pOut may be NULL
+  // to only measure the output.
+  size_t outLen = 0;
+  size_t i = 0;
+  int replacing = 0;
+
+  while (i < len)
   {
-    if (*pBufferLen - sanitizedLen < len - validStart)
+    size_t run = percent_clean_run(pSet, pStr + i, len - i);
+
+    if (run > 0)
+    {
+      if (pOut != NULL)
+      {
+        memcpy(pOut + outLen, pStr + i, run);
+      }
+
+      outLen += run;
+      i += run;
+      replacing = 0;
+
+      if (i == len)
+      {
+        break;
+      }
+    }
+
+    // Validate a whole sequence before encoding its bytes
+    const char* pSeq = pStr + i;
+    size_t seqLen = 1;
+
+    if (((unsigned char)pStr[i] & (unsigned)hi1) != none)
+    {
+      uint32_t codePoint;
+      seqLen = decode_utf8(pStr + i, len - i, &codePoint);
+
+      if (codePoint == invalid_code_point)
+      {
+        if (!sanitize)
+        {
+          return conversion_failed;
+        }
+
+        i += seqLen;
+
+        if (replacing)
+        {
+          continue;
+        }
+
+        replacing = 1;
+        pSeq = replacement_escape.pText;
+        seqLen = replacement_escape.len;
+      }
+      else
+      {
+        replacing = 0;
+        i += seqLen;
+      }
+    }
+    else
     {
-      *pBufferLen = sanitizedLen + len - validStart;
-      pRet = realloc(pRet, *pBufferLen);
+      replacing = 0;
+      ++i;
     }
 
-    memcpy(pRet + sanitizedLen, pStr + validStart, len - validStart);
-    sanitizedLen += len - validStart;
+    for (size_t j = 0; j < seqLen; ++j)
+    {
+      const unsigned char c = (unsigned char)pSeq[j];
+
+      if (c == ' ' && pSet->spaceAsPlus)
+      {
+        if (pOut != NULL)
+        {
+          pOut[outLen] = '+';
+        }
+        ++outLen;
+      }
+      else
+      {
+        if (pOut != NULL)
+        {
+          pOut[outLen] = '%';
+          pOut[outLen + 1] = hex_digits[c >> 4U];
+          pOut[outLen + 2] = hex_digits[c & 0x0FU];
+        }
+        outLen += 3;
+      }
+    }
   }
 
-  *pBufferLen = sanitizedLen;
-  return pRet;
+  return outLen;
 }
 
 static enum states_is_utf8 advance_start(const unsigned char c)
@@ -219,25 +4902,25 @@ static enum states_is_utf8 advance(const unsigned char c, const enum states_is_u
       }
       return invalid;
     case overlong_3_check:
-      if ((c & (unsigned)overlong_3) != 0)
+      if ((c & (unsigned)hi2) == hi1 && (c & (unsigned)overlong_3) != 0)
       {
         return continue_1;
       }
       return invalid;
     case overlong_4_check:
-      if ((c & (unsigned)overlong_4) != 0)
+      if ((c & (unsigned)hi2) == hi1 && (c & (unsigned)overlong_4) != 0)
       {
         return continue_2;
       }
       return invalid;
     case max_check:
-      if (c > (unsigned char)max)
+      if ((c & (unsigned)hi2) != hi1 || c > (unsigned char)max)
       {
         return invalid;
       }
       return continue_2;
     case surrogate_pair_check:
-      if ((c & (unsigned)surrogate_pair) != 0)
+      if ((c & (unsigned)hi2) != hi1 || (c & (unsigned)surrogate_pair) != 0)
       {
         return invalid;
       }
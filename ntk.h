@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief Check whether a given buffer is a valid UTF-8 string.
@@ -22,10 +23,1238 @@ int ntk_is_utf8(const char* pStr, size_t len);
  * @param pStr Buffer to sanitize.
  * @param len Length of the buffer.
  * @param pBufferLen Output: length of the sanitized string.
- * @return Sanitized copy of pStr. If pStr is NULL, NULL is returned.
+ * @return Sanitized copy of pStr, allocated with malloc and exactly sized. If pStr is NULL, len is 0 or allocation
+ *         fails, NULL is returned.
  */
 char* ntk_sanitize_utf8(const char* pStr, size_t len, size_t* pBufferLen);
 
+/**
+ * @brief Compute the length of a Latin-1 (ISO-8859-1) string once converted to UTF-8.
+ * @param pStr Latin-1 buffer to measure.
+ * @param len Length of the buffer.
+ * @return Exact number of bytes ntk_latin1_to_utf8 will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_latin1(const char* pStr, size_t len);
+
+/**
+ * @brief Convert a Latin-1 (ISO-8859-1) string to UTF-8.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_latin1(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_latin1_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a UTF-8 string once converted to Latin-1 (ISO-8859-1).
+ * @note The input is not validated. The result is exact when ntk_utf8_to_latin1 succeeds, and is otherwise an upper
+ *       bound.
+ * @param pStr UTF-8 buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of bytes ntk_utf8_to_latin1 will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_latin1_length_from_utf8(const char* pStr, size_t len);
+
+/**
+ * @brief Convert a UTF-8 string to Latin-1 (ISO-8859-1).
+ * @note Conversion stops at the first invalid sequence or code point above U+00FF.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_latin1_length_from_utf8(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8, cannot be represented in Latin-1, or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_latin1(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the number of UTF-16 code units needed to hold a UTF-8 string.
+ * @note The input is not validated. The result is exact for valid UTF-8.
+ * @param pStr UTF-8 buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of UTF-16 code units. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf16_length_from_utf8(const char* pStr, size_t len);
+
+/**
+ * @brief Compute the number of UTF-32 code units (code points) in a UTF-8 string.
+ * @note The input is not validated. The result is exact for valid UTF-8.
+ * @param pStr UTF-8 buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of UTF-32 code units. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf32_length_from_utf8(const char* pStr, size_t len);
+
+/**
+ * @brief Compute the number of bytes needed to hold a UTF-16 string as UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-16.
+ * @param pStr UTF-16 buffer to measure, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-8 bytes. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf16(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of UTF-32 code units (code points) in a UTF-16 string.
+ * @note The input is not validated. The result is exact for valid UTF-16.
+ * @param pStr UTF-16 buffer to measure, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-32 code units. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf32_length_from_utf16(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of bytes needed to hold a UTF-32 string as UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-32.
+ * @param pStr UTF-32 buffer to measure, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-8 bytes. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf32(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of UTF-16 code units needed to hold a UTF-32 string.
+ * @note The input is not validated. The result is exact for valid UTF-32.
+ * @param pStr UTF-32 buffer to measure, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-16 code units. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf16_length_from_utf32(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Single-byte character sets understood by ntk_charset_to_utf8. Bytes 0x00 - 0x7F are ASCII in all of them.
+ */
+enum ntk_charset
+{
+  ntk_charset_iso_8859_1,
+  ntk_charset_iso_8859_2,
+  ntk_charset_iso_8859_3,
+  ntk_charset_iso_8859_4,
+  ntk_charset_iso_8859_5,
+  ntk_charset_iso_8859_6,
+  ntk_charset_iso_8859_7,
+  ntk_charset_iso_8859_8,
+  ntk_charset_iso_8859_9,
+  ntk_charset_iso_8859_10,
+  ntk_charset_iso_8859_11,
+  ntk_charset_iso_8859_13,
+  ntk_charset_iso_8859_14,
+  ntk_charset_iso_8859_15,
+  ntk_charset_iso_8859_16,
+  ntk_charset_windows_1250,
+  ntk_charset_windows_1251,
+  ntk_charset_windows_1252,
+  ntk_charset_windows_1253,
+  ntk_charset_windows_1254,
+  ntk_charset_windows_1255,
+  ntk_charset_windows_1256,
+  ntk_charset_windows_1257,
+  ntk_charset_windows_1258,
+  ntk_charset_koi8_r,
+};
+
+/**
+ * @brief Compute the length of a single-byte character set string once converted to UTF-8.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param charset Character set of pStr.
+ * @return Exact number of bytes ntk_charset_to_utf8 will write. If pStr is NULL or charset is unknown, 0 is returned.
+ */
+size_t ntk_utf8_length_from_charset(const char* pStr, size_t len, enum ntk_charset charset);
+
+/**
+ * @brief Convert a single-byte character set string to UTF-8.
+ * @note Bytes which are unassigned in the character set are replaced with U+FFFD.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param charset Character set of pStr.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_charset(pStr, len, charset) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if charset is unknown or pStr or pOut is NULL.
+ */
+int ntk_charset_to_utf8(const char* pStr, size_t len, enum ntk_charset charset, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Multi-byte East Asian character sets understood by ntk_multibyte_to_utf8. Bytes 0x00 - 0x7F which do not
+ *        continue a multi-byte sequence are ASCII in all of them.
+ */
+enum ntk_multibyte_charset
+{
+  ntk_multibyte_shift_jis, //!< Shift_JIS with the Windows (code page 932) extensions
+  ntk_multibyte_euc_jp,    //!< EUC-JP, including JIS X 0212 three-byte sequences
+  ntk_multibyte_gb18030,   //!< GB18030, which is a superset of GBK and GB2312
+  ntk_multibyte_big5,      //!< Big5 with the Windows (code page 950) extensions
+  ntk_multibyte_euc_kr,    //!< EUC-KR with the Unified Hangul Code (code page 949) extensions
+};
+
+/**
+ * @brief Compute the length of a multi-byte character set string once converted to UTF-8.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param charset Character set of pStr.
+ * @return Exact number of bytes ntk_multibyte_to_utf8 will write. If pStr is NULL or charset is unknown, 0 is
+ *         returned.
+ */
+size_t ntk_utf8_length_from_multibyte(const char* pStr, size_t len, enum ntk_multibyte_charset charset);
+
+/**
+ * @brief Convert a multi-byte character set string to UTF-8.
+ * @note As with ntk_sanitize_utf8, a run of consecutive invalid or unmapped sequences is replaced by a single U+FFFD.
+ *       An ASCII byte which cannot continue a sequence ends the invalid sequence and is kept.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param charset Character set of pStr.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_multibyte(pStr, len, charset) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if charset is unknown or pStr or pOut is NULL.
+ */
+int ntk_multibyte_to_utf8(const char* pStr, size_t len, enum ntk_multibyte_charset charset, char* pOut,
+                          size_t* pOutLen);
+
+/**
+ * @brief State for converting a multi-byte character set stream to UTF-8 one chunk at a time.
+ */
+struct ntk_multibyte_decoder
+{
+  enum ntk_multibyte_charset charset;
+  unsigned char pending[3]; //!< Start of a sequence which continues in the next chunk
+  size_t pendingLen;
+  int replacing;            //!< Whether the last character written was U+FFFD
+};
+
+/**
+ * @brief Prepare a decoder for the start of a stream.
+ * @param pDecoder Decoder to initialize.
+ * @param charset Character set of the stream.
+ */
+void ntk_multibyte_decoder_init(struct ntk_multibyte_decoder* pDecoder, enum ntk_multibyte_charset charset);
+
+/**
+ * @brief Convert the next chunk of a multi-byte character set stream to UTF-8.
+ * @note A sequence split across chunks is held in the decoder until the rest arrives, so the output is the same as
+ *       ntk_multibyte_to_utf8 on the whole stream. After the final chunk the decoder is ready for a new stream.
+ * @param pDecoder Decoder initialized with ntk_multibyte_decoder_init.
+ * @param pStr Next chunk of the stream. May be NULL if len is 0.
+ * @param len Length of the chunk.
+ * @param final Nonzero if this is the last chunk. A sequence left incomplete at the end is replaced with U+FFFD.
+ * @param pOut Output buffer. Must hold at least 3 * (len + 3) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if the decoder's charset is unknown, pDecoder or pOut is NULL, or pStr is NULL and len is
+ *         not 0.
+ */
+int ntk_multibyte_decode(struct ntk_multibyte_decoder* pDecoder, const char* pStr, size_t len, int final, char* pOut,
+                         size_t* pOutLen);
+
+/**
+ * @brief Check whether a given buffer is valid CESU-8.
+ * @note CESU-8 encodes supplementary code points as a pair of three-byte surrogates instead of a four-byte sequence.
+ * @param pStr Buffer to check.
+ * @param len Length of the buffer.
+ * @return 1 if the buffer is valid CESU-8, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_cesu8(const char* pStr, size_t len);
+
+/**
+ * @brief Check whether a given buffer is valid Modified UTF-8, as used by Java serialization and JNI.
+ * @note Modified UTF-8 is CESU-8 with NUL encoded as 0xC0 0x80. A raw 0x00 byte is invalid.
+ * @param pStr Buffer to check.
+ * @param len Length of the buffer.
+ * @return 1 if the buffer is valid Modified UTF-8, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_mutf8(const char* pStr, size_t len);
+
+/**
+ * @brief Validate a CESU-8 string and convert it to UTF-8.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least len bytes; the output is never longer than the input.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid CESU-8 or pStr or pOut is NULL.
+ */
+int ntk_cesu8_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a Modified UTF-8 string and convert it to UTF-8.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least len bytes; the output is never longer than the input.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid Modified UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_mutf8_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a UTF-8 string once converted to CESU-8.
+ * @note The input is not validated. The result is exact for valid UTF-8.
+ * @param pStr UTF-8 buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of bytes ntk_utf8_to_cesu8 will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_cesu8_length_from_utf8(const char* pStr, size_t len);
+
+/**
+ * @brief Compute the length of a UTF-8 string once converted to Modified UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-8.
+ * @param pStr UTF-8 buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of bytes ntk_utf8_to_mutf8 will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_mutf8_length_from_utf8(const char* pStr, size_t len);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to CESU-8.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_cesu8_length_from_utf8(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_cesu8(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to Modified UTF-8.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_mutf8_length_from_utf8(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_mutf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Check whether a given buffer is valid WTF-8.
+ * @note WTF-8 is UTF-8 which may also contain unpaired surrogates (U+D800 - U+DFFF), so that potentially ill-formed
+ *       UTF-16 such as Windows file names can be represented losslessly. A surrogate pair must still be encoded as a
+ *       single four-byte sequence.
+ * @param pStr Buffer to check.
+ * @param len Length of the buffer.
+ * @return 1 if the buffer is valid WTF-8, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_wtf8(const char* pStr, size_t len);
+
+/**
+ * @brief Validate a WTF-8 string and convert it to potentially ill-formed UTF-16.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, in native byte order. Must hold at least ntk_utf16_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid WTF-8 or pStr or pOut is NULL.
+ */
+int ntk_wtf8_to_utf16(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a WTF-8 string and convert it to UTF-8, replacing each unpaired surrogate with U+FFFD.
+ * @note Both encodings take three bytes, so the output is always the same length as the input. pOut may be pStr.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least len bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid WTF-8 or pStr or pOut is NULL.
+ */
+int ntk_wtf8_to_utf8(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a potentially ill-formed UTF-16 string once converted to WTF-8.
+ * @param pStr UTF-16 buffer to measure, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return Exact number of bytes ntk_utf16_to_wtf8 will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_wtf8_length_from_utf16(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Convert a potentially ill-formed UTF-16 string to WTF-8.
+ * @param pStr Buffer to convert, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_wtf8_length_from_utf16(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_utf16_to_wtf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a potentially ill-formed UTF-16 string once converted to UTF-8 by
+ *        ntk_utf16_to_utf8_lossy.
+ * @param pStr UTF-16 buffer to measure, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return Exact number of bytes ntk_utf16_to_utf8_lossy will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf16_lossy(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Convert a potentially ill-formed UTF-16 string to UTF-8, replacing unpaired surrogates with U+FFFD.
+ * @note As with ntk_sanitize_utf8, a run of consecutive unpaired surrogates is replaced by a single U+FFFD.
+ * @param pStr Buffer to convert, in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf16_lossy(pStr, len) bytes; 3 * len bytes is
+ *             always enough.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_utf16_to_utf8_lossy(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Check whether a given buffer is valid UTF-16.
+ * @param pStr Buffer to check, with code units in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return 1 if the buffer is valid UTF-16, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_utf16(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Check whether a given buffer is valid UTF-16LE.
+ * @param pStr Buffer to check, with code units stored little-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return 1 if the buffer is valid UTF-16LE, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_utf16le(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Check whether a given buffer is valid UTF-16BE.
+ * @param pStr Buffer to check, with code units stored big-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return 1 if the buffer is valid UTF-16BE, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_utf16be(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of bytes needed to hold a UTF-16LE string as UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-16LE.
+ * @param pStr UTF-16LE buffer to measure, with code units stored little-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-8 bytes. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf16le(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of bytes needed to hold a UTF-16BE string as UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-16BE.
+ * @param pStr UTF-16BE buffer to measure, with code units stored big-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-8 bytes. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf16be(const uint16_t* pStr, size_t len);
+
+/**
+ * @brief Validate a UTF-16 string and convert it to UTF-8.
+ * @param pStr Buffer to convert, with code units in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf16(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-16 or pStr or pOut is NULL.
+ */
+int ntk_utf16_to_utf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-16LE string and convert it to UTF-8.
+ * @param pStr Buffer to convert, with code units stored little-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf16le(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-16LE or pStr or pOut is NULL.
+ */
+int ntk_utf16le_to_utf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-16BE string and convert it to UTF-8.
+ * @param pStr Buffer to convert, with code units stored big-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf16be(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-16BE or pStr or pOut is NULL.
+ */
+int ntk_utf16be_to_utf8(const uint16_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to UTF-16.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, with code units written in native byte order. Must hold at least
+ *             ntk_utf16_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_utf16(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to UTF-16LE.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, with code units written little-endian regardless of the host. Must hold at least
+ *             ntk_utf16_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_utf16le(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to UTF-16BE.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, with code units written big-endian regardless of the host. Must hold at least
+ *             ntk_utf16_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_utf16be(const char* pStr, size_t len, uint16_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Check whether a given buffer is valid UTF-32.
+ * @param pStr Buffer to check, with code units in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @return 1 if the buffer is valid UTF-32, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_utf32(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Check whether a given buffer is valid UTF-32LE.
+ * @param pStr Buffer to check, with code units stored little-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return 1 if the buffer is valid UTF-32LE, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_utf32le(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Check whether a given buffer is valid UTF-32BE.
+ * @param pStr Buffer to check, with code units stored big-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return 1 if the buffer is valid UTF-32BE, 0 otherwise. If pStr is NULL, 0 is always returned.
+ */
+int ntk_is_utf32be(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of bytes needed to hold a UTF-32LE string as UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-32LE.
+ * @param pStr UTF-32LE buffer to measure, with code units stored little-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-8 bytes. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf32le(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Compute the number of bytes needed to hold a UTF-32BE string as UTF-8.
+ * @note The input is not validated. The result is exact for valid UTF-32BE.
+ * @param pStr UTF-32BE buffer to measure, with code units stored big-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @return Number of UTF-8 bytes. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_length_from_utf32be(const uint32_t* pStr, size_t len);
+
+/**
+ * @brief Validate a UTF-32 string and convert it to UTF-8.
+ * @param pStr Buffer to convert, with code units in native byte order.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf32(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-32 or pStr or pOut is NULL.
+ */
+int ntk_utf32_to_utf8(const uint32_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-32LE string and convert it to UTF-8.
+ * @param pStr Buffer to convert, with code units stored little-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf32le(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-32LE or pStr or pOut is NULL.
+ */
+int ntk_utf32le_to_utf8(const uint32_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-32BE string and convert it to UTF-8.
+ * @param pStr Buffer to convert, with code units stored big-endian regardless of the host.
+ * @param len Length of the buffer, in code units.
+ * @param pOut Output buffer. Must hold at least ntk_utf8_length_from_utf32be(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-32BE or pStr or pOut is NULL.
+ */
+int ntk_utf32be_to_utf8(const uint32_t* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to UTF-32.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, with code units written in native byte order. Must hold at least
+ *             ntk_utf32_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_utf32(const char* pStr, size_t len, uint32_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to UTF-32LE.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, with code units written little-endian regardless of the host. Must hold at least
+ *             ntk_utf32_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_utf32le(const char* pStr, size_t len, uint32_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Validate a UTF-8 string and convert it to UTF-32BE.
+ * @param pStr Buffer to convert.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer, with code units written big-endian regardless of the host. Must hold at least
+ *             ntk_utf32_length_from_utf8(pStr, len) code units.
+ * @param pOutLen Output: number of code units written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL.
+ */
+int ntk_utf8_to_utf32be(const char* pStr, size_t len, uint32_t* pOut, size_t* pOutLen);
+
+/**
+ * @brief Encodings which ntk_sniff_encoding can report.
+ */
+enum ntk_encoding
+{
+  ntk_encoding_utf8,
+  ntk_encoding_utf16le,
+  ntk_encoding_utf16be,
+  ntk_encoding_utf32le,
+  ntk_encoding_utf32be,
+  ntk_encoding_single_byte, //!< One of the character sets in enum ntk_charset
+};
+
+/**
+ * @brief One candidate encoding reported by ntk_sniff_encoding.
+ */
+struct ntk_encoding_guess
+{
+  enum ntk_encoding encoding;
+  enum ntk_charset charset; //!< Only meaningful when encoding is ntk_encoding_single_byte
+  int confidence;           //!< 0 (no evidence) to 100 (certain, e.g. from a byte order mark)
+  size_t bomLen;            //!< Length of the byte order mark at the start of the buffer, or 0 if there is none
+};
+
+/**
+ * @brief Guess the encoding of a buffer.
+ * @note A byte order mark is always trusted and produces a single guess. Otherwise, one pass over a bounded prefix of
+ *       the buffer collects the placement of zero bytes (UTF-16 and UTF-32), whether the prefix is valid UTF-8, and
+ *       the frequency of each byte above 0x7F, which is scored against every single-byte character set alongside the
+ *       share of ASCII letters.
+ * @param pStr Buffer to examine.
+ * @param len Length of the buffer.
+ * @param pGuesses Output: plausible encodings, most likely first.
+ * @param maxGuesses Capacity of pGuesses.
+ * @return Number of guesses written to pGuesses. If pStr or pGuesses is NULL, 0 is returned.
+ */
+size_t ntk_sniff_encoding(const char* pStr, size_t len, struct ntk_encoding_guess* pGuesses, size_t maxGuesses);
+
+/**
+ * @brief Compute the length of a string once escaped for an HTML text node.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @return Exact number of bytes ntk_escape_html will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_html_length(const char* pStr, size_t len);
+
+/**
+ * @brief Escape a string for an HTML text node.
+ * @note The characters & < > " and ' become &amp; &lt; &gt; &quot; and &#39;. Every other byte is copied unchanged.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_html_length(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_html(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Create an escaped copy of a string for an HTML text node, as ntk_escape_html does.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pBufferLen Output: length of the escaped string.
+ * @return Escaped copy of pStr, allocated with malloc and exactly sized. If pStr is NULL, len is 0 or allocation
+ *         fails, NULL is returned.
+ */
+char* ntk_escape_html_alloc(const char* pStr, size_t len, size_t* pBufferLen);
+
+/**
+ * @brief Kinds of HTML attribute value, each of which must escape a different set of characters.
+ */
+enum ntk_html_attribute
+{
+  ntk_html_attribute_double_quoted, //!< name="value": escapes & and "
+  ntk_html_attribute_single_quoted, //!< name='value': escapes & and '
+  ntk_html_attribute_unquoted,      //!< name=value: escapes & < > " ' ` =, spaces and control characters
+};
+
+/**
+ * @brief Compute the length of a string once escaped for an HTML attribute value.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param attribute Kind of attribute value pStr will be written into.
+ * @return Exact number of bytes ntk_escape_html_attribute will write. If pStr is NULL or attribute is unknown, 0 is
+ *         returned.
+ */
+size_t ntk_escape_html_attribute_length(const char* pStr, size_t len, enum ntk_html_attribute attribute);
+
+/**
+ * @brief Escape a string for an HTML attribute value.
+ * @note Characters are escaped as named or decimal character references, except NUL, which is written as U+FFFD
+ *       (&#65533;) because HTML parsers never produce it. An empty unquoted value cannot be represented; write an
+ *       empty quoted value instead.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param attribute Kind of attribute value pStr will be written into.
+ * @param pOut Output buffer. Must hold at least ntk_escape_html_attribute_length(pStr, len, attribute) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if attribute is unknown or pStr or pOut is NULL.
+ */
+int ntk_escape_html_attribute(const char* pStr, size_t len, enum ntk_html_attribute attribute, char* pOut,
+                              size_t* pOutLen);
+
+/**
+ * @brief Create an escaped copy of a string for an HTML attribute value, as ntk_escape_html_attribute does.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param attribute Kind of attribute value pStr will be written into.
+ * @param pBufferLen Output: length of the escaped string.
+ * @return Escaped copy of pStr, allocated with malloc and exactly sized. If pStr is NULL, len is 0, attribute is
+ *         unknown or allocation fails, NULL is returned.
+ */
+char* ntk_escape_html_attribute_alloc(const char* pStr, size_t len, enum ntk_html_attribute attribute,
+                                      size_t* pBufferLen);
+
+/**
+ * @brief URL components which ntk_escape_url can percent-encode a value for.
+ */
+enum ntk_url_component
+{
+  ntk_url_path_segment, //!< One path segment: RFC 3986 pchar, so / is encoded
+  ntk_url_query,        //!< RFC 3986 query: pchar, / and ?
+  ntk_url_fragment,     //!< RFC 3986 fragment: pchar, / and ?
+  ntk_url_userinfo,     //!< A user name or password: RFC 3986 userinfo without :, which separates them
+  ntk_url_form,         //!< application/x-www-form-urlencoded name or value: alphanumerics and * - . _, space as +
+};
+
+/**
+ * @brief Compute the length of a string once percent-encoded for a URL component.
+ * @note The result is exact when ntk_escape_url succeeds.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param component URL component pStr will be written into.
+ * @return Number of bytes ntk_escape_url will write. If pStr is NULL, component is unknown or pStr is not valid UTF-8,
+ *         0 is returned.
+ */
+size_t ntk_escape_url_length(const char* pStr, size_t len, enum ntk_url_component component);
+
+/**
+ * @brief Validate a UTF-8 string and percent-encode it for a URL component.
+ * @note Bytes outside the component's allowed set, including every byte of a multi-byte sequence, are written as %XX
+ *       with uppercase hexadecimal digits.
+ * @param pStr Buffer to encode.
+ * @param len Length of the buffer.
+ * @param component URL component pStr will be written into.
+ * @param pOut Output buffer. Must hold at least ntk_escape_url_length(pStr, len, component) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8, component is unknown, or pStr or pOut is NULL.
+ */
+int ntk_escape_url(const char* pStr, size_t len, enum ntk_url_component component, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Decode a percent-encoded URL component and validate the result as UTF-8.
+ * @note A % which is not followed by two hexadecimal digits is copied unchanged, as browsers do. Decoding never grows
+ *       the data, so pOut may be pStr to decode in place.
+ * @param pStr Buffer to decode.
+ * @param len Length of the buffer.
+ * @param plusAsSpace Nonzero to decode + as a space, as in application/x-www-form-urlencoded data.
+ * @param pOut Output buffer. Must hold at least len bytes. May be the same as pStr.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the decoded bytes are not valid UTF-8 or pStr or pOut is NULL. On failure, pOut may have
+ *         been partially written.
+ */
+int ntk_unescape_url(const char* pStr, size_t len, int plusAsSpace, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a string once escaped as the body of a C string literal.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @return Exact number of bytes ntk_escape_c will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_c_length(const char* pStr, size_t len);
+
+/**
+ * @brief Escape a string as the body of a C string literal, without the surrounding quotes.
+ * @note Printable ASCII is copied, except " and \ (and a ? following another ?, which could form a trigraph), which
+ *       are preceded by a backslash. Control characters with a short escape use it (\n, \t, ...), and every other
+ *       byte, including each byte of a multi-byte UTF-8 sequence, is written as \xNN. Because a hexadecimal escape
+ *       would absorb a following hexadecimal digit, a byte followed by one is written as a three-digit octal escape
+ *       instead. The output is therefore plain ASCII and independent of the source character set.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_c_length(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_c(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Decode the body of a C string literal, without the surrounding quotes.
+ * @note Simple escapes, octal escapes of one to three digits, hexadecimal escapes and universal character names
+ *       (\uXXXX and \UXXXXXXXX, written as UTF-8) are decoded; every other byte is copied. Decoding never grows the
+ *       data, so pOut may be pStr to decode in place.
+ * @param pStr Buffer to decode.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least len bytes. May be the same as pStr.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if pStr or pOut is NULL, or the input has an unknown or incomplete escape, a hexadecimal
+ *         escape above 0xFF, or a universal character name which is a surrogate or above U+10FFFF. On failure, pOut
+ *         may have been partially written.
+ */
+int ntk_unescape_c(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a UTF-8 string once escaped as the body of a JSON string.
+ * @note The result is exact for ntk_escape_json_sanitized, and for ntk_escape_json when it succeeds.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param escapeLineSeparators Nonzero to count U+2028 and U+2029 as escaped.
+ * @return Number of bytes ntk_escape_json or ntk_escape_json_sanitized will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_json_length(const char* pStr, size_t len, int escapeLineSeparators);
+
+/**
+ * @brief Validate a UTF-8 string and escape it as the body of a JSON string, without the surrounding quotes.
+ * @note " and \ are preceded by a backslash, and control characters are written as \b, \f, \n, \r, \t or \u00XX.
+ *       Everything else is copied.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param escapeLineSeparators Nonzero to also write U+2028 and U+2029 as \u2028 and \u2029, which older JavaScript
+ *                             parsers treat as line breaks.
+ * @param pOut Output buffer. Must hold at least ntk_escape_json_length(pStr, len, escapeLineSeparators) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL. On failure, pOut may have been
+ *         partially written.
+ */
+int ntk_escape_json(const char* pStr, size_t len, int escapeLineSeparators, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Escape a UTF-8 string as the body of a JSON string, sanitizing it in the same pass.
+ * @note As ntk_escape_json, except that each run of invalid sequences is replaced with a single U+FFFD, as
+ *       ntk_sanitize_utf8 does.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param escapeLineSeparators Nonzero to also write U+2028 and U+2029 as \u2028 and \u2029.
+ * @param pOut Output buffer. Must hold at least ntk_escape_json_length(pStr, len, escapeLineSeparators) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_json_sanitized(const char* pStr, size_t len, int escapeLineSeparators, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Decode the body of a JSON string, without the surrounding quotes, to UTF-8.
+ * @note Escaped surrogate pairs are combined into one code point. The output is always valid UTF-8: the input must
+ *       be valid UTF-8 without unescaped " or control characters, and unpaired escaped surrogates are rejected.
+ *       Decoding never grows the data, so pOut may be pStr to decode in place.
+ * @param pStr Buffer to decode.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least len bytes. May be the same as pStr.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not a valid JSON string body or pStr or pOut is NULL. On failure, pOut may
+ *         have been partially written.
+ */
+int ntk_unescape_json(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a string once sanitized and escaped for XML 1.0 text or attribute values.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param replaceIllegal Nonzero to count characters XML does not allow as replaced rather than dropped.
+ * @return Exact number of bytes ntk_escape_xml will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_xml_length(const char* pStr, size_t len, int replaceIllegal);
+
+/**
+ * @brief Sanitize a UTF-8 string and escape it for XML 1.0 text or attribute values.
+ * @note & < > " and ' become &amp; &lt; &gt; &quot; and &apos;. Each run of invalid UTF-8 sequences is replaced with a
+ *       single U+FFFD, as ntk_sanitize_utf8 does. Characters which XML 1.0 does not allow at all (control characters
+ *       other than tab, line feed and carriage return, U+FFFE and U+FFFF) are dropped, or replaced with U+FFFD.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param replaceIllegal Nonzero to replace characters XML does not allow with U+FFFD instead of dropping them.
+ * @param pOut Output buffer. Must hold at least ntk_escape_xml_length(pStr, len, replaceIllegal) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_xml(const char* pStr, size_t len, int replaceIllegal, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of HTML text once its character references are decoded.
+ * @note The result is exact when ntk_unescape_html succeeds.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param inAttribute Nonzero if pStr is an attribute value, as for ntk_unescape_html.
+ * @return Number of bytes ntk_unescape_html will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_unescape_html_length(const char* pStr, size_t len, int inAttribute);
+
+/**
+ * @brief Decode the character references in HTML text or an attribute value to UTF-8.
+ * @note Numeric references and all of the named references in the HTML standard are decoded as an HTML parser would:
+ *       the longest matching name is used, the few legacy names which may omit their semicolon are matched without
+ *       it, and numeric references to NUL, surrogates or values above U+10FFFF become U+FFFD, while those to
+ *       0x80 - 0x9F are read as Windows-1252. An & which does not start a reference is copied unchanged. The input must
+ *       be valid UTF-8, so the output is too.
+ *
+ *       Decoding only grows the data for &nGt; and &nLt;, so pOut may be pStr to decode in place. In that case,
+ *       decoding fails if one of them would overwrite input which has not been read yet.
+ * @param pStr Buffer to decode.
+ * @param len Length of the buffer.
+ * @param inAttribute Nonzero if pStr is an attribute value, where a named reference without its semicolon is not
+ *                    decoded when followed by = or an alphanumeric character.
+ * @param pOut Output buffer. Must hold at least ntk_unescape_html_length(pStr, len, inAttribute) bytes. May be the
+ *             same as pStr.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL. On failure, pOut may have been
+ *         partially written.
+ */
+int ntk_unescape_html(const char* pStr, size_t len, int inAttribute, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a string once sanitized and quoted as a POSIX shell word.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @return Exact number of bytes ntk_escape_shell will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_shell_length(const char* pStr, size_t len);
+
+/**
+ * @brief Sanitize a UTF-8 string and quote it as a single POSIX shell word.
+ * @note The string is wrapped in single quotes, inside which the shell treats every byte literally, and each ' becomes
+ *       '\''. Each run of invalid UTF-8 sequences is replaced with a single U+FFFD, as ntk_sanitize_utf8 does, and so
+ *       is each NUL byte, since no argument can contain one.
+ * @param pStr Buffer to quote.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_shell_length(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_shell(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a list of arguments once quoted by ntk_escape_shell_args.
+ * @param ppArgs Arguments to measure.
+ * @param pLens Length of each argument.
+ * @param count Number of arguments.
+ * @return Exact number of bytes ntk_escape_shell_args will write. If ppArgs, pLens or any argument is NULL, 0 is
+ *         returned.
+ */
+size_t ntk_escape_shell_args_length(const char* const* ppArgs, const size_t* pLens, size_t count);
+
+/**
+ * @brief Quote each of a list of arguments as ntk_escape_shell does, separated by spaces, into a single buffer.
+ * @param ppArgs Arguments to quote.
+ * @param pLens Length of each argument.
+ * @param count Number of arguments.
+ * @param pOut Output buffer. Must hold at least ntk_escape_shell_args_length(ppArgs, pLens, count) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if ppArgs, pLens, any argument or pOut is NULL.
+ */
+int ntk_escape_shell_args(const char* const* ppArgs, const size_t* pLens, size_t count, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a string once sanitized and written as an RFC 4180 CSV field.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @return Exact number of bytes ntk_escape_csv will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_csv_length(const char* pStr, size_t len);
+
+/**
+ * @brief Sanitize a UTF-8 string and write it as an RFC 4180 CSV field.
+ * @note A field containing a comma, quote, carriage return or line feed is wrapped in quotes, with each quote inside it
+ *       doubled; any other field is written as is. Each run of invalid UTF-8 sequences is replaced with a single
+ *       U+FFFD, as ntk_sanitize_utf8 does.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_csv_length(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_csv(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Compute the length of a CSV record once written by ntk_escape_csv_record.
+ * @param ppFields Fields to measure.
+ * @param pLens Length of each field.
+ * @param count Number of fields.
+ * @return Exact number of bytes ntk_escape_csv_record will write. If ppFields, pLens or any field is NULL, 0 is
+ *         returned.
+ */
+size_t ntk_escape_csv_record_length(const char* const* ppFields, const size_t* pLens, size_t count);
+
+/**
+ * @brief Write each of a list of fields as ntk_escape_csv does, separated by commas and followed by CRLF, into a
+ *        single buffer.
+ * @param ppFields Fields to write.
+ * @param pLens Length of each field.
+ * @param count Number of fields.
+ * @param pOut Output buffer. Must hold at least ntk_escape_csv_record_length(ppFields, pLens, count) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if ppFields, pLens, any field or pOut is NULL.
+ */
+int ntk_escape_csv_record(const char* const* ppFields, const size_t* pLens, size_t count, char* pOut,
+                          size_t* pOutLen);
+
+/**
+ * @brief Read the CSV field at the start of a buffer, removing its quotes if it has any.
+ * @note The field ends at the first comma, carriage return or line feed outside quotes, or at the end of the buffer.
+ *       A quoted field must be closed, and must end right after its closing quote. An unquoted field must not contain
+ *       quotes. Bytes are copied as they are, without checking that they are valid UTF-8.
+ *
+ *       Fields never grow when unquoted, so pOut may be pStr to unquote in place.
+ * @param pStr Buffer to read.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least len bytes. May be the same as pStr.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @param pUsed Output: number of bytes of pStr the field took up, not counting the comma or line break ending it. Set
+ *              to 0 on failure.
+ * @return 1 on success, 0 if the field is malformed or pStr or pOut is NULL. On failure, pOut may have been partially
+ *         written.
+ */
+int ntk_unescape_csv(const char* pStr, size_t len, char* pOut, size_t* pOutLen, size_t* pUsed);
+
+/**
+ * @brief Compute the length of a string once escaped as the body of a JavaScript string literal.
+ * @note The result is exact for ntk_escape_js_sanitized, and for ntk_escape_js when it succeeds.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of bytes ntk_escape_js or ntk_escape_js_sanitized will write. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_escape_js_length(const char* pStr, size_t len);
+
+/**
+ * @brief Validate a UTF-8 string and escape it as the body of a JavaScript string literal, safe to embed in an HTML
+ *        script element.
+ * @note ", ', `, $ and \ are preceded by a backslash, so the result can go inside any kind of quotes. < and > are
+ *       written as \x3C and \x3E, so it can never close the script element or open an HTML comment. Control characters
+ *       are written as \b, \t, \n, \v, \f, \r or \xXX, and U+2028 and U+2029 as \u2028 and \u2029. Everything else is
+ *       copied.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_js_length(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pStr or pOut is NULL. On failure, pOut may have been
+ *         partially written.
+ */
+int ntk_escape_js(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Escape a UTF-8 string as the body of a JavaScript string literal, sanitizing it in the same pass.
+ * @note As ntk_escape_js, except that each run of invalid sequences is replaced with a single U+FFFD, as
+ *       ntk_sanitize_utf8 does.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_js_length(pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL.
+ */
+int ntk_escape_js_sanitized(const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Escaping contexts which ntk_escape_spans supports.
+ */
+enum ntk_escape_format
+{
+  ntk_escape_format_html,                         //!< As ntk_escape_html
+  ntk_escape_format_html_attribute,               //!< As ntk_escape_html_attribute, ntk_html_attribute_double_quoted
+  ntk_escape_format_json,                         //!< As ntk_escape_json, leaving U+2028 and U+2029 as they are
+  ntk_escape_format_js,                           //!< As ntk_escape_js
+  ntk_escape_format_xml,                          //!< As ntk_escape_xml, dropping characters XML does not allow
+  ntk_escape_format_html_attribute_single_quoted, //!< As ntk_escape_html_attribute, ntk_html_attribute_single_quoted
+  ntk_escape_format_html_attribute_unquoted,      //!< As ntk_escape_html_attribute, ntk_html_attribute_unquoted
+};
+
+/**
+ * @brief A piece of escaped output, pointing into either the input or a static escape sequence.
+ * @note The members are in the same order as those of POSIX struct iovec, so converting a list of spans for writev()
+ *       is a simple copy.
+ */
+struct ntk_span
+{
+  const char* pData; //!< Start of the piece
+  size_t len;        //!< Length of the piece
+};
+
+/**
+ * @brief Escape a UTF-8 string without copying it, as a list of spans which together make up the escaped output.
+ * @note Runs of characters which need no escaping are left in place and referred to by spans into pStr, while each
+ *       escape sequence is a span into a static table, so nothing is copied. Each run of invalid UTF-8 sequences is
+ *       replaced with a single U+FFFD, as ntk_sanitize_utf8 does.
+ *
+ *       If pSpans fills up, escaping stops early. The spans written so far cover the returned number of input bytes,
+ *       and the rest of the input can be escaped with another call.
+ * @param pStr Buffer to escape. Must stay alive while the spans are in use.
+ * @param len Length of the buffer.
+ * @param format Escaping context.
+ * @param pSpans Output: spans making up the escaped output, in order. None is empty.
+ * @param maxSpans Number of spans pSpans can hold.
+ * @param pSpanCount Output: number of spans written to pSpans.
+ * @return Number of bytes of pStr which the spans cover, which is len unless pSpans filled up. If pStr or pSpans is
+ *         NULL or format is unknown, 0 is returned.
+ */
+size_t ntk_escape_spans(const char* pStr, size_t len, enum ntk_escape_format format, struct ntk_span* pSpans,
+                        size_t maxSpans, size_t* pSpanCount);
+
+/**
+ * @brief Compute the length of a string once sanitized and escaped by ntk_escape_sanitized.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param format Escaping context.
+ * @return Exact number of bytes ntk_escape_sanitized will write. If pStr is NULL or format is unknown, 0 is returned.
+ */
+size_t ntk_escape_sanitized_length(const char* pStr, size_t len, enum ntk_escape_format format);
+
+/**
+ * @brief Sanitize a UTF-8 string and escape it, in a single pass.
+ * @note The output is that of escaping the output of ntk_sanitize_utf8, so it is always valid UTF-8, but the input is
+ *       only read once and no intermediate copy is made.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param format Escaping context.
+ * @param pOut Output buffer. Must hold at least ntk_escape_sanitized_length(pStr, len, format) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL or format is unknown.
+ */
+int ntk_escape_sanitized(const char* pStr, size_t len, enum ntk_escape_format format, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Create a sanitized and escaped copy of a UTF-8 string, as ntk_escape_sanitized does.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param format Escaping context.
+ * @param pBufferLen Output: length of the escaped string.
+ * @return Escaped copy of pStr, allocated with malloc and exactly sized. If pStr is NULL, len is 0, format is unknown
+ *         or allocation fails, NULL is returned.
+ */
+char* ntk_escape_sanitized_alloc(const char* pStr, size_t len, enum ntk_escape_format format, size_t* pBufferLen);
+
+/**
+ * @brief Compute the length of a string once sanitized and percent-encoded by ntk_escape_url_sanitized.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @param component URL component pStr will be written into.
+ * @return Exact number of bytes ntk_escape_url_sanitized will write. If pStr is NULL or component is unknown, 0 is
+ *         returned.
+ */
+size_t ntk_escape_url_sanitized_length(const char* pStr, size_t len, enum ntk_url_component component);
+
+/**
+ * @brief Sanitize a UTF-8 string and percent-encode it for a URL component, in a single pass.
+ * @note As ntk_escape_url, except that each run of invalid sequences is encoded as a single U+FFFD (%EF%BF%BD), as
+ *       ntk_sanitize_utf8 does, rather than failing.
+ * @param pStr Buffer to encode.
+ * @param len Length of the buffer.
+ * @param component URL component pStr will be written into.
+ * @param pOut Output buffer. Must hold at least ntk_escape_url_sanitized_length(pStr, len, component) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pStr or pOut is NULL or component is unknown.
+ */
+int ntk_escape_url_sanitized(const char* pStr, size_t len, enum ntk_url_component component, char* pOut,
+                             size_t* pOutLen);
+
+/**
+ * @brief Create a sanitized and percent-encoded copy of a UTF-8 string, as ntk_escape_url_sanitized does.
+ * @param pStr Buffer to encode.
+ * @param len Length of the buffer.
+ * @param component URL component pStr will be written into.
+ * @param pBufferLen Output: length of the encoded string.
+ * @return Encoded copy of pStr, allocated with malloc and exactly sized. If pStr is NULL, len is 0, component is
+ *         unknown or allocation fails, NULL is returned.
+ */
+char* ntk_escape_url_sanitized_alloc(const char* pStr, size_t len, enum ntk_url_component component,
+                                     size_t* pBufferLen);
+
+/**
+ * @brief A range of code points outside ASCII which a custom escaper replaces.
+ */
+struct ntk_code_point_escape
+{
+  uint32_t first;    //!< First code point in the range, at least U+0080
+  uint32_t last;     //!< Last code point in the range, at most U+10FFFF
+  const char* pText; //!< Replacement for each code point in the range. May be empty, to drop them.
+};
+
+/**
+ * @brief A custom escaping context, created by ntk_escaper_create.
+ */
+struct ntk_escaper;
+
+/**
+ * @brief Compile a custom escaping context.
+ * @note The replacements are classified once, here, so that a custom escaper scans unescaped text a word at a time as
+ *       the built-in escapers do. Escaped control characters are found with one compare, and other escaped ASCII
+ *       bytes with at most four range compares, merging the closest ranges if there are more. Bytes in the gaps of
+ *       merged ranges are rechecked one at a time, which slows down text dense with them. Escaping with it validates
+ *       or sanitizes UTF-8 in the same pass.
+ * @param ppAsciiEscapes 128 replacements, indexed by ASCII byte, or NULL to escape no ASCII bytes. A NULL entry leaves
+ *                       that byte unchanged, and an empty one drops it.
+ * @param pCodePoints Ranges of code points outside ASCII to replace. Checked in order, so earlier ranges take
+ *                    precedence where they overlap.
+ * @param codePointCount Number of ranges in pCodePoints.
+ * @return Escaper, which copies every replacement and so does not depend on the arguments once created. It is a
+ *         single allocation, which must be released with free(). If a range is invalid or has a NULL replacement,
+ *         pCodePoints is NULL while codePointCount is not 0, or allocation fails, NULL is returned.
+ */
+struct ntk_escaper* ntk_escaper_create(const char* const* ppAsciiEscapes,
+                                       const struct ntk_code_point_escape* pCodePoints, size_t codePointCount);
+
+/**
+ * @brief Compute the length of a string once escaped with a custom escaper.
+ * @note The result is exact for ntk_escape_custom_sanitized, and for ntk_escape_custom when it succeeds.
+ * @param pEscaper Escaper to use.
+ * @param pStr Buffer to measure.
+ * @param len Length of the buffer.
+ * @return Number of bytes ntk_escape_custom or ntk_escape_custom_sanitized will write. If pEscaper or pStr is NULL, 0
+ *         is returned.
+ */
+size_t ntk_escape_custom_length(const struct ntk_escaper* pEscaper, const char* pStr, size_t len);
+
+/**
+ * @brief Validate a UTF-8 string and escape it with a custom escaper.
+ * @param pEscaper Escaper to use.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_custom_length(pEscaper, pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut. Set to 0 on failure.
+ * @return 1 on success, 0 if the input is not valid UTF-8 or pEscaper, pStr or pOut is NULL. On failure, pOut may have
+ *         been partially written.
+ */
+int ntk_escape_custom(const struct ntk_escaper* pEscaper, const char* pStr, size_t len, char* pOut, size_t* pOutLen);
+
+/**
+ * @brief Escape a UTF-8 string with a custom escaper, sanitizing it in the same pass.
+ * @note As ntk_escape_custom, except that each run of invalid sequences is replaced with a single U+FFFD, as
+ *       ntk_sanitize_utf8 does.
+ * @param pEscaper Escaper to use.
+ * @param pStr Buffer to escape.
+ * @param len Length of the buffer.
+ * @param pOut Output buffer. Must hold at least ntk_escape_custom_length(pEscaper, pStr, len) bytes.
+ * @param pOutLen Output: number of bytes written to pOut.
+ * @return 1 on success, 0 if pEscaper, pStr or pOut is NULL.
+ */
+int ntk_escape_custom_sanitized(const struct ntk_escaper* pEscaper, const char* pStr, size_t len, char* pOut,
+                                size_t* pOutLen);
+
+/**
+ * @brief Count the code points in a UTF-8 string.
+ * @note The input is not validated: every byte which is not a continuation byte counts as one code point.
+ * @param pStr Buffer to count.
+ * @param len Length of the buffer.
+ * @return Number of code points in pStr. If pStr is NULL, 0 is returned.
+ */
+size_t ntk_utf8_count_code_points(const char* pStr, size_t len);
+
+/**
+ * @brief Validate a UTF-8 string and count its code points, in a single pass.
+ * @param pStr Buffer to check.
+ * @param len Length of the buffer.
+ * @param pCount Output: number of code points in pStr. Set to 0 if pStr is not valid UTF-8.
+ * @return 1 if pStr is valid UTF-8, 0 otherwise. If pStr is NULL, 0 is returned.
+ */
+int ntk_utf8_count_code_points_validated(const char* pStr, size_t len, size_t* pCount);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,577 @@
+#ifndef NTK_HTML_ENTITIES_H
+#define NTK_HTML_ENTITIES_H
+
+// Generated by tools/gen_html_entities.py. Do not edit.
+
+enum html_entities
+{
+  html_entity_count = 2231,
+  html_entity_buckets = 558,
+  html_entity_max_name = 32, // Including the semicolon
+  html_entity_max_legacy_name = 6, // Longest name which may omit the semicolon
+};
+
+static const uint16_t html_entity_displacements[558] = {
+  9, 8, 1, 60, 1, 3, 26, 167, 15, 5, 2, 10, 158, 163, 2, 12,
+  41, 4, 24, 88, 7, 26, 3, 12, 9, 122, 34, 99, 1, 11, 1, 46,
+  26, 23, 110, 47, 82, 60, 176, 18, 15, 12, 95, 15, 7, 2, 2, 243,
+  19, 40, 75, 27, 10, 27, 109, 16, 61, 13, 79, 299, 2, 2, 1, 15,
+  4, 54, 2, 37, 48, 9, 31, 20, 1, 7, 64, 0, 21, 17, 3, 2,
+  18, 0, 8, 12, 3, 18, 179, 17, 16, 1, 106, 105, 22, 60, 5, 65,
+  1, 1, 66, 31, 292, 133, 0, 401, 60, 472, 2, 70, 4, 1, 59, 6,
+  106, 50, 378, 169, 95, 17, 7, 149, 1, 75, 4, 48, 65, 4, 79, 20,
+  158, 50, 22, 69, 1, 38, 83, 23, 6, 54, 2, 7, 138, 3, 35, 27,
+  6, 1, 7, 3, 351, 1, 128, 1, 24, 1, 3, 71, 95, 151, 6, 50,
+  0, 68, 61, 59, 6, 117, 410, 179, 5, 13, 2, 51, 4, 146, 37, 82,
+  166, 70, 52, 2, 72, 109, 0, 6, 510, 145, 9, 36, 26, 3, 29, 0,
+  29, 3, 1, 168, 14, 143, 0, 16, 71, 6, 476, 1, 20, 228, 3, 3,
+  0, 45, 45, 2, 2, 445, 750, 36, 1, 243, 105, 119, 1, 68, 16, 4,
+  19, 14, 114, 1, 122, 103, 154, 11, 3, 40, 7, 449, 288, 293, 81, 9,
+  4, 3, 8, 84, 1, 1, 63, 1, 3, 273, 35, 4, 631, 57, 7, 5,
+  140, 142, 94, 356, 19, 211, 52, 3, 2, 2, 4, 69, 62, 26, 73, 305,
+  15, 4, 1, 1, 30, 5, 1, 27, 53, 1, 70, 4, 15, 11, 2, 1,
+  533, 300, 107, 422, 7, 2, 209, 5, 46, 18, 2, 135, 53, 4, 142, 57,
+  10, 126, 680, 367, 69, 7, 3, 28, 99, 2, 34, 31, 1, 44, 14, 549,
+  274, 27, 122, 36, 18, 208, 714, 335, 311, 2, 3, 7, 177, 17, 175, 69,
+  694, 6, 68, 45, 407, 66, 25, 493, 5, 7, 406, 265, 22, 2084, 20, 916,
+  266, 20, 39, 363, 272, 287, 120, 3, 1, 5, 25, 15, 250, 52, 5, 56,
+  56, 1343, 14, 752, 97, 8, 17, 346, 46, 15, 263, 1047, 46, 158, 1662, 1423,
+  99, 245, 6, 697, 4, 11, 6, 3, 9, 930, 31, 136, 1, 139, 4, 110,
+  2, 89, 20, 6, 273, 2, 205, 55, 1, 28, 7, 181, 684, 663, 1, 202,
+  4, 6, 382, 1726, 1, 69, 2431, 3, 34, 138, 121, 4, 577, 250, 553, 4,
+  25, 2, 25, 3, 1, 6, 166, 447, 14, 64, 1, 108, 24, 8, 340, 970,
+  573, 19, 9, 31, 487, 4, 80, 2, 669, 1700, 94, 19, 11, 3857, 19, 44,
+  88, 2, 4, 72, 343, 1630, 1, 498, 89, 119, 12, 3665, 17, 52, 17, 170,
+  78, 781, 262, 1, 119, 201, 228, 64, 188, 936, 89, 280, 0, 39, 76, 13,
+  364, 576, 14, 15, 731, 3, 163, 3626, 640, 568, 663, 324, 10, 240, 96, 24,
+  419, 380, 373, 547, 1348, 532, 1246, 371, 237, 4, 470, 2418, 33, 63, 24, 2534,
+  229, 119, 27, 84, 1, 165, 2475, 768, 4, 234, 6, 580, 6, 4300, 2, 175,
+  3520, 34, 1044, 1254, 9, 2764, 2210, 391, 2211, 370, 414, 1864, 200, 59,
+};
+
+// Names without the leading &, by slot
+static const char* const html_entity_names[2231] = {
+  "Imacr;", "Copf;", "geq;", "LeftArrowRightArrow;", "oelig;", "utilde;", "uuml;", "Otimes;", "telrec;", "olarr;",
+  "quatint;", "vltri;", "nldr;", "questeq;", "ngt;", "Acirc;", "Uuml", "subsetneq;", "Lmidot;", "lstrok;", "not;",
+  "roang;", "Zcaron;", "propto;", "nsubseteqq;", "uwangle;", "Delta;", "uacute", "hbar;", "rightharpoonup;", "lap;",
+  "InvisibleComma;", "Abreve;", "zfr;", "boxUR;", "lesdotor;", "ccaron;", "iexcl", "downdownarrows;", "quaternions;",
+  "NotLeftTriangle;", "yicy;", "gvertneqq;", "Jfr;", "lrcorner;", "nwarrow;", "odblac;", "tilde;", "aring;", "ucy;",
+  "dharl;", "backepsilon;", "ensp;", "ntriangleright;", "lmoustache;", "lcub;", "sscr;", "Otilde;", "pre;", "phiv;",
+  "DownLeftVectorBar;", "complexes;", "Pi;", "lltri;", "Wscr;", "larrfs;", "ocirc", "vscr;", "thicksim;", "epar;",
+  "eqslantless;", "SquareUnion;", "colon;", "beth;", "GreaterEqual;", "LeftTee;", "laquo;", "DownLeftRightVector;",
+  "circ;", "Eogon;", "lneq;", "Rcaron;", "sup1;", "tbrk;", "bigodot;", "rightleftarrows;", "laemptyv;", "mstpos;",
+  "cirE;", "gtrsim;", "ShortDownArrow;", "blacksquare;", "umacr;", "ContourIntegral;", "oacute", "cacute;", "ic;",
+  "ouml", "acd;", "af;", "Barv;", "cularr;", "inodot;", "eopf;", "rarrb;", "rbrace;", "rfr;", "xrarr;",
+  "rightharpoondown;", "xrArr;", "subsup;", "ShortUpArrow;", "Dcaron;", "vartheta;", "Conint;", "crarr;", "sigmaf;",
+  "nbsp", "intcal;", "nesear;", "ngeqq;", "UpTee;", "nvap;", "epsi;", "uarr;", "hopf;", "UnderBracket;", "sqcup;",
+  "leqslant;", "nrtri;", "ucirc;", "acirc", "andand;", "RightTriangleEqual;", "eth;", "ucirc", "gesdotol;", "frac45;",
+  "sce;", "RightTriangle;", "DiacriticalDot;", "cirfnint;", "Omicron;", "boxVH;", "caret;", "nequiv;", "numsp;",
+  "ltri;", "tcedil;", "Vbar;", "lhblk;", "DoubleLongRightArrow;", "lrtri;", "Xi;", "SmallCircle;", "supseteq;",
+  "vrtri;", "lessapprox;", "udarr;", "rmoustache;", "smt;", "ncong;", "check;", "Union;", "thorn;", "NotLessLess;",
+  "dbkarow;", "lang;", "csup;", "NotGreaterTilde;", "Vfr;", "larrhk;", "mapstoleft;", "ntlg;", "xsqcup;", "thinsp;",
+  "bprime;", "scnE;", "prod;", "xnis;", "lscr;", "prap;", "udhar;", "RightArrow;", "lfr;", "Kcy;", "Ograve;",
+  "MinusPlus;", "Ycirc;", "downharpoonleft;", "cong;", "Dfr;", "rsquo;", "utdot;", "varnothing;", "tridot;", "vert;",
+  "smid;", "efDot;", "prcue;", "Ucy;", "napos;", "nLt;", "CapitalDifferentialD;", "nsubE;", "Or;", "gE;", "gtreqless;",
+  "yuml;", "Ograve", "hslash;", "bopf;", "hamilt;", "iukcy;", "plusmn", "Oscr;", "copy;", "ltquest;", "Rcy;", "sstarf;",
+  "lnsim;", "ssmile;", "lessgtr;", "nltrie;", "acE;", "nsubset;", "roplus;", "Acy;", "Kfr;", "thksim;",
+  "RightDownTeeVector;", "ast;", "nfr;", "ascr;", "euml", "nwnear;", "Lleftarrow;", "imped;", "auml;", "prnap;", "and;",
+  "angrt;", "DoubleContourIntegral;", "frac14;", "NotSubset;", "macr;", "Atilde", "ltlarr;", "Umacr;", "xharr;",
+  "frac56;", "vArr;", "geqq;", "gne;", "And;", "ange;", "tcaron;", "comp;", "rcaron;", "varpropto;", "boxh;",
+  "rightthreetimes;", "rdquor;", "searhk;", "plusmn;", "nexists;", "Cap;", "cross;", "target;", "demptyv;", "Uacute",
+  "nrarrw;", "angmsd;", "copysr;", "multimap;", "wopf;", "Bscr;", "Pcy;", "Gcedil;", "icirc", "ffr;", "Lang;",
+  "LeftTriangle;", "DownArrowUpArrow;", "Ufr;", "DoubleDot;", "cemptyv;", "rarr;", "amacr;", "NotLess;", "scnsim;",
+  "llcorner;", "equals;", "ZHcy;", "capbrcup;", "rceil;", "NotSquareSuperset;", "race;", "sqsube;", "Jsercy;",
+  "nsupset;", "frac23;", "leftthreetimes;", "CenterDot;", "pcy;", "ggg;", "Uopf;", "nvge;", "SquareSubset;", "supsim;",
+  "rightsquigarrow;", "Scy;", "expectation;", "scpolint;", "rlm;", "rsquor;", "erDot;", "Esim;", "nLeftarrow;",
+  "xcirc;", "Vdashl;", "ropf;", "leftharpoonup;", "DiacriticalGrave;", "LeftTeeArrow;", "Mu;", "ShortRightArrow;",
+  "lrhard;", "nesim;", "xutri;", "awint;", "supseteqq;", "uml", "seswar;", "ncedil;", "Vvdash;", "DoubleRightTee;",
+  "middot;", "real;", "ovbar;", "preceq;", "andslope;", "emacr;", "rtrif;", "apacir;", "RightAngleBracket;",
+  "VerticalBar;", "LeftDownVector;", "smtes;", "Dcy;", "simlE;", "drbkarow;", "curlyvee;", "longrightarrow;",
+  "DownTeeArrow;", "YIcy;", "sqsubseteq;", "rsh;", "ccups;", "bcy;", "nsup;", "bernou;", "elinters;", "iquest;",
+  "cuesc;", "ohbar;", "Nacute;", "duhar;", "Prime;", "Rsh;", "SucceedsSlantEqual;", "wcirc;", "NotRightTriangleBar;",
+  "andv;", "DiacriticalTilde;", "rdquo;", "Colon;", "straightphi;", "ntilde", "ang;", "boxdr;", "NotLessGreater;",
+  "NotLessSlantEqual;", "mid;", "Scirc;", "chi;", "hyphen;", "blacktriangle;", "LongRightArrow;", "xi;", "simg;",
+  "eng;", "lE;", "setminus;", "DotEqual;", "RoundImplies;", "forall;", "Iuml;", "vellip;", "xlArr;", "ldrushar;",
+  "Wedge;", "robrk;", "eplus;", "udblac;", "odash;", "boxVh;", "Zcy;", "Lsh;", "FilledSmallSquare;", "nsucceq;",
+  "ldrdhar;", "rrarr;", "ReverseEquilibrium;", "alpha;", "uplus;", "csube;", "nsc;", "Wfr;", "rppolint;", "sqsupset;",
+  "apos;", "nlsim;", "backsim;", "succneqq;", "ddotseq;", "Zeta;", "Zdot;", "suplarr;", "ldsh;", "Rrightarrow;",
+  "oror;", "DownRightVector;", "shchcy;", "Icirc;", "simplus;", "DiacriticalDoubleAcute;", "NewLine;", "lat;", "RBarr;",
+  "Uarrocir;", "Lfr;", "lnap;", "uml;", "NotCongruent;", "bumpeq;", "Ucirc", "sum;", "reg", "Gopf;", "varrho;",
+  "acute;", "npart;", "rharul;", "lfloor;", "Cfr;", "gcy;", "MediumSpace;", "ne;", "nspar;", "lozenge;", "nis;", "ifr;",
+  "sfr;", "gtrarr;", "varepsilon;", "VeryThinSpace;", "auml", "Yacute", "curren", "eacute", "swarr;", "fopf;",
+  "straightepsilon;", "Ouml", "ring;", "Euml;", "LeftRightVector;", "odsold;", "Kscr;", "Downarrow;", "egs;", "lsquor;",
+  "profline;", "sigmav;", "oast;", "bump;", "kscr;", "ograve", "boxdR;", "odiv;", "Ouml;", "downharpoonright;", "chcy;",
+  "Equilibrium;", "Zfr;", "uharl;", "gel;", "qfr;", "Odblac;", "Dashv;", "notindot;", "nrightarrow;", "lne;", "boxhD;",
+  "backprime;", "Phi;", "LessLess;", "ltcir;", "TripleDot;", "profsurf;", "iuml;", "vprop;", "iocy;", "THORN", "dopf;",
+  "mcomma;", "NotRightTriangle;", "Updownarrow;", "boxvL;", "RightTeeVector;", "bnequiv;", "varsigma;", "Leftarrow;",
+  "leg;", "cdot;", "NotRightTriangleEqual;", "Lambda;", "lacute;", "zeta;", "suphsub;", "sqsub;", "dd;", "CircleMinus;",
+  "khcy;", "ncup;", "bsol;", "hcirc;", "lsaquo;", "shy", "Product;", "simne;", "boxDR;", "curvearrowright;", "Rho;",
+  "ETH", "nang;", "acute", "ecaron;", "Rang;", "NotSupersetEqual;", "Mopf;", "REG", "solbar;", "LeftCeiling;", "ccedil",
+  "excl;", "curlyeqprec;", "LeftDownTeeVector;", "complement;", "ldca;", "rarrw;", "gneqq;", "imacr;", "dtri;",
+  "otilde;", "langle;", "divide", "nshortparallel;", "popf;", "nisd;", "SOFTcy;", "urcorn;", "ruluhar;", "yucy;",
+  "isinE;", "NotTildeTilde;", "bigoplus;", "lesdot;", "oslash;", "fallingdotseq;", "zopf;", "kopf;", "dzigrarr;",
+  "slarr;", "twoheadrightarrow;", "gnsim;", "hArr;", "gcirc;", "forkv;", "ffllig;", "euro;", "boxVr;", "aring", "rcub;",
+  "RuleDelayed;", "sdot;", "oplus;", "intlarhk;", "ulcrop;", "vee;", "agrave;", "Efr;", "xvee;", "tcy;", "gamma;",
+  "Sum;", "omega;", "Qfr;", "eqsim;", "VerticalLine;", "Therefore;", "precnsim;", "boxhd;", "ii;", "harrw;",
+  "LeftUpVectorBar;", "ycirc;", "seArr;", "Iota;", "looparrowright;", "zwj;", "sub;", "nLtv;", "Longleftrightarrow;",
+  "nsime;", "Bcy;", "realine;", "NotNestedLessLess;", "Agrave", "qint;", "die;", "racute;", "qprime;", "boxhu;",
+  "scedil;", "RightDownVector;", "loang;", "Longrightarrow;", "vzigzag;", "Rightarrow;", "DoubleLeftTee;", "cirscir;",
+  "angsph;", "xdtri;", "lbrksld;", "theta;", "Zacute;", "empty;", "bbrk;", "aacute;", "epsilon;", "top;", "isin;",
+  "Rfr;", "rAarr;", "compfn;", "Verbar;", "OverBracket;", "tscr;", "boxplus;", "gEl;", "afr;", "nvsim;",
+  "SupersetEqual;", "alefsym;", "rbrkslu;", "Cconint;", "ordf", "blacklozenge;", "ecolon;", "pscr;", "Lcaron;", "njcy;",
+  "REG;", "mumap;", "lmoust;", "ordm", "emsp13;", "vdash;", "lessdot;", "mscr;", "simrarr;", "Colone;", "Igrave",
+  "pertenk;", "kcy;", "triangleleft;", "easter;", "bot;", "lsh;", "scirc;", "lrhar;", "approx;", "sup2", "xuplus;",
+  "gjcy;", "NotVerticalBar;", "half;", "subsim;", "niv;", "xotime;", "eDDot;", "ForAll;", "leq;", "boxvH;", "oslash",
+  "nharr;", "eacute;", "LeftArrow;", "Assign;", "tfr;", "UpArrow;", "Cdot;", "boxUl;", "Not;", "varr;", "emsp14;",
+  "lrarr;", "Iopf;", "grave;", "vDash;", "ogon;", "nsub;", "macr", "mapstoup;", "harr;", "Ascr;", "orderof;", "ltdot;",
+  "rdca;", "jopf;", "rarrsim;", "tscy;", "VerticalSeparator;", "minus;", "gtcc;", "Tilde;", "rangle;", "brvbar;",
+  "lbrace;", "ordf;", "uharr;", "ncap;", "bull;", "gfr;", "ltrie;", "psi;", "lcedil;", "jcy;", "varsupsetneqq;", "pi;",
+  "semi;", "NJcy;", "UpArrowBar;", "ll;", "dzcy;", "NotSquareSupersetEqual;", "Jscr;", "Lopf;", "frac14", "Gg;",
+  "zdot;", "LeftVector;", "Larr;", "bdquo;", "CHcy;", "Jcirc;", "lparlt;", "dash;", "mcy;", "doublebarwedge;", "tshcy;",
+  "iacute;", "efr;", "UpArrowDownArrow;", "circledast;", "nvrtrie;", "mapsto;", "smashp;", "permil;",
+  "EmptyVerySmallSquare;", "boxHU;", "cuepr;", "notni;", "NotSucceedsSlantEqual;", "Implies;", "scnap;", "percnt;",
+  "boxur;", "angmsdaa;", "UpDownArrow;", "delta;", "eDot;", "rcedil;", "AElig;", "angrtvbd;", "pitchfork;",
+  "rationals;", "marker;", "leftarrowtail;", "gbreve;", "starf;", "nleftrightarrow;", "rlarr;", "supE;", "mopf;",
+  "CloseCurlyQuote;", "Ifr;", "Omacr;", "varkappa;", "trianglerighteq;", "urcrop;", "supsup;", "NotDoubleVerticalBar;",
+  "submult;", "frac12", "gtreqqless;", "ofr;", "DiacriticalAcute;", "rbrksld;", "ntrianglerighteq;", "lagran;",
+  "UpperRightArrow;", "fscr;", "updownarrow;", "Tcedil;", "comma;", "Scaron;", "boxvR;", "bbrktbrk;", "nLl;", "kappav;",
+  "Hfr;", "imagpart;", "apid;", "olcross;", "lEg;", "nVDash;", "sime;", "Kappa;", "rx;", "sol;", "twixt;", "hkswarow;",
+  "Precedes;", "nsupseteq;", "NotLessEqual;", "Equal;", "uuml", "sup1", "Mscr;", "igrave", "TRADE;", "ofcir;",
+  "nearrow;", "RightArrowLeftArrow;", "leftharpoondown;", "lfisht;", "nge;", "cularrp;", "cup;", "rarrtl;", "angmsdac;",
+  "bepsi;", "circledR;", "els;", "lurdshar;", "larrlp;", "frac13;", "TScy;", "coprod;", "subnE;", "vBar;", "trpezium;",
+  "wedge;", "SHcy;", "kcedil;", "DoubleDownArrow;", "mho;", "planckh;", "trianglelefteq;", "Tcaron;", "curlywedge;",
+  "amp", "NotHumpEqual;", "gap;", "Eacute;", "UnderBar;", "duarr;", "bemptyv;", "wr;", "rfisht;", "boxDL;", "boxhU;",
+  "NotTildeEqual;", "micro", "nap;", "boxuR;", "supdot;", "Upsi;", "topfork;", "range;", "rdldhar;", "uHar;",
+  "angmsdae;", "Wopf;", "NotCupCap;", "Escr;", "bfr;", "curlyeqsucc;", "mlcp;", "nlE;", "wreath;", "dcy;",
+  "DownArrowBar;", "rbrke;", "swArr;", "nprcue;", "Dagger;", "prec;", "cwconint;", "midcir;", "angmsdad;", "gesles;",
+  "olt;", "DScy;", "sup2;", "aelig", "QUOT", "angrtvb;", "VerticalTilde;", "xwedge;", "FilledVerySmallSquare;",
+  "supnE;", "rangd;", "nLeftrightarrow;", "shcy;", "prsim;", "HumpEqual;", "oscr;", "LeftUpDownVector;", "Ecaron;",
+  "ntriangleleft;", "DDotrahd;", "Int;", "Gcy;", "DownArrow;", "Im;", "circledS;", "urtri;", "xcap;", "sqsubset;",
+  "Tscr;", "operp;", "gesl;", "NotSubsetEqual;", "leftrightarrows;", "lAarr;", "OpenCurlyQuote;", "exponentiale;",
+  "egsdot;", "latail;", "RightUpTeeVector;", "ApplyFunction;", "notniva;", "copf;", "Ucirc;", "nGtv;", "bigcirc;",
+  "Dscr;", "Icy;", "LeftRightArrow;", "minusb;", "Uogon;", "nrArr;", "UnderParenthesis;", "Uring;", "planck;",
+  "Fouriertrf;", "ThickSpace;", "order;", "InvisibleTimes;", "Gscr;", "roarr;", "DotDot;", "lvnE;", "lbrack;", "TSHcy;",
+  "LeftFloor;", "Iacute", "times", "nvrArr;", "sqcap;", "GT;", "larrpl;", "infintie;", "ocy;", "Ccaron;", "fltns;",
+  "Ubrcy;", "barwed;", "eqcolon;", "frac15;", "Topf;", "boxUr;", "zcy;", "strns;", "iecy;", "mldr;", "subseteq;",
+  "bigtriangledown;", "frac18;", "Succeeds;", "djcy;", "Dot;", "otilde", "boxvl;", "homtht;", "veeeq;", "gtrapprox;",
+  "Iukcy;", "yacute", "Lcy;", "topbot;", "bNot;", "siml;", "HARDcy;", "sc;", "Psi;", "npolint;", "NotGreater;",
+  "Hacek;", "Mellintrf;", "szlig", "sqsupe;", "elsdot;", "LeftVectorBar;", "Eta;", "bsime;", "Pscr;", "dstrok;",
+  "lhard;", "ecir;", "Tfr;", "nrtrie;", "backsimeq;", "blank;", "scsim;", "smallsetminus;", "rcy;", "Proportion;",
+  "supedot;", "Tstrok;", "rlhar;", "diam;", "divide;", "intprod;", "smeparsl;", "Udblac;", "larrbfs;", "nrarrc;",
+  "Sup;", "shortmid;", "DoubleUpDownArrow;", "orv;", "circlearrowright;", "hscr;", "ccaps;", "block;",
+  "NotHumpDownHump;", "LeftTriangleEqual;", "Egrave;", "lmidot;", "scE;", "ycy;", "clubs;", "boxuL;", "boxDl;", "Hopf;",
+  "zwnj;", "RightVectorBar;", "shortparallel;", "caps;", "boxbox;", "DoubleLeftRightArrow;", "curren;", "lcaron;",
+  "Kopf;", "vBarv;", "lHar;", "angle;", "rHar;", "frac34;", "dotplus;", "sdote;", "gopf;", "plusdu;", "phmmat;",
+  "quot;", "ZeroWidthSpace;", "GreaterLess;", "nsucc;", "angmsdag;", "triplus;", "DownRightVectorBar;", "dotminus;",
+  "Re;", "supsetneq;", "breve;", "Vert;", "vsupne;", "measuredangle;", "squf;", "Xopf;", "nmid;", "subplus;", "qscr;",
+  "sup3;", "zacute;", "drcrop;", "napprox;", "ljcy;", "nlt;", "ssetmn;", "daleth;", "gtrless;", "oline;", "softcy;",
+  "DownBreve;", "tstrok;", "ufisht;", "ocirc;", "Eopf;", "gimel;", "isinsv;", "incare;", "Jukcy;", "divideontimes;",
+  "Itilde;", "sacute;", "bsolb;", "ge;", "tosa;", "LeftAngleBracket;", "glE;", "Pfr;", "blk34;", "nsccue;", "xmap;",
+  "nges;", "DJcy;", "frac78;", "OverBrace;", "le;", "Laplacetrf;", "nshortmid;", "eg;", "glj;", "filig;", "Hcirc;",
+  "lbrke;", "ecy;", "nsmid;", "NotLeftTriangleEqual;", "brvbar", "supsub;", "Rcedil;", "Xscr;", "varphi;", "bottom;",
+  "models;", "gvnE;", "PartialD;", "NotSucceedsTilde;", "nsube;", "rfloor;", "gesdoto;", "sext;", "upharpoonleft;",
+  "lescc;", "OElig;", "boxdL;", "backcong;", "rarrfs;", "notinE;", "imath;", "cupdot;", "csupe;", "smte;", "egrave",
+  "circledcirc;", "ltimes;", "Oslash;", "COPY", "Yscr;", "NotGreaterGreater;", "mapstodown;", "circleddash;", "sbquo;",
+  "part;", "bigwedge;", "gammad;", "origof;", "dsol;", "Vee;", "hairsp;", "blacktriangledown;", "LeftDownVectorBar;",
+  "rtriltri;", "Uuml;", "Aogon;", "CounterClockwiseContourIntegral;", "blacktriangleleft;", "jfr;", "Exists;", "spar;",
+  "RightCeiling;", "supsetneqq;", "ShortLeftArrow;", "equest;", "scap;", "minusd;", "notnivb;", "gnE;", "cap;",
+  "Racute;", "Pr;", "circeq;", "sharp;", "hardcy;", "boxH;", "gtrdot;", "Aacute", "plusacir;", "rarrc;", "thickapprox;",
+  "capcup;", "notinva;", "bullet;", "RightDoubleBracket;", "parsl;", "SquareIntersection;", "sqcups;", "frac35;",
+  "ufr;", "Nopf;", "rightarrowtail;", "Lscr;", "looparrowleft;", "NegativeThinSpace;", "Leftrightarrow;", "hstrok;",
+  "nearr;", "PrecedesSlantEqual;", "yopf;", "otimesas;", "angmsdab;", "subne;", "nleqslant;", "clubsuit;", "orslope;",
+  "lthree;", "EqualTilde;", "twoheadleftarrow;", "nsupE;", "NegativeMediumSpace;", "NotPrecedesEqual;", "sopf;",
+  "ntilde;", "nvltrie;", "NotGreaterSlantEqual;", "ropar;", "para;", "lg;", "NotNestedGreaterGreater;", "GreaterTilde;",
+  "Tab;", "Agrave;", "thetav;", "leftrightharpoons;", "bigcup;", "dfisht;", "larrb;", "Vcy;", "rightrightarrows;",
+  "curarr;", "checkmark;", "odot;", "Ofr;", "GT", "KJcy;", "CircleTimes;", "ldquo;", "parallel;", "raquo;", "lesg;",
+  "eogon;", "nacute;", "emptyv;", "heartsuit;", "Bfr;", "capand;", "Cross;", "icirc;", "emptyset;", "upsilon;", "imof;",
+  "Cayleys;", "eqslantgtr;", "Breve;", "sqsup;", "swarhk;", "Yacute;", "nless;", "barvee;", "quot", "horbar;",
+  "leftrightarrow;", "flat;", "CirclePlus;", "searrow;", "plussim;", "topcir;", "Hstrok;", "ges;", "because;",
+  "nsupseteqq;", "VDash;", "LeftTriangleBar;", "integers;", "hfr;", "Ocirc", "nRightarrow;", "rect;", "rdsh;", "boxV;",
+  "eth", "boxv;", "gneq;", "tint;", "ImaginaryI;", "lgE;", "bumpE;", "asymp;", "utrif;", "cupbrcap;", "les;", "cire;",
+  "ccupssm;", "luruhar;", "Del;", "utri;", "ctdot;", "Epsilon;", "doteqdot;", "triangledown;", "copy", "vcy;",
+  "prnsim;", "Theta;", "curvearrowleft;", "Icirc", "plusdo;", "rarrbfs;", "Upsilon;", "sect;", "cent;", "nsce;",
+  "GreaterFullEqual;", "yuml", "rtimes;", "QUOT;", "times;", "nsupe;", "boxVl;", "rbbrk;", "dlcrop;", "digamma;",
+  "between;", "DownLeftTeeVector;", "gl;", "leftarrow;", "gscr;", "OpenCurlyDoubleQuote;", "Intersection;", "nedot;",
+  "there4;", "ee;", "swarrow;", "ulcorn;", "Sc;", "triangle;", "malt;", "barwedge;", "ntgl;", "egrave;", "Supset;",
+  "GJcy;", "cupcup;", "nlarr;", "llarr;", "sqsupseteq;", "bigcap;", "mDDot;", "Mfr;", "isinv;", "Ncy;", "frac25;",
+  "Ecirc;", "NotSuperset;", "Barwed;", "verbar;", "nwarhk;", "timesbar;", "rpargt;", "ord;", "Omega;", "nhpar;", "rho;",
+  "lneqq;", "nltri;", "Ocirc;", "beta;", "harrcir;", "nsqsube;", "ulcorner;", "ldquor;", "Ccedil;", "igrave;",
+  "wedbar;", "darr;", "rArr;", "el;", "jscr;", "centerdot;", "ClockwiseContourIntegral;", "YUcy;", "uparrow;", "caron;",
+  "biguplus;", "LessTilde;", "congdot;", "ltcc;", "diamond;", "Ntilde;", "Cacute;", "rarrhk;", "DZcy;", "nsimeq;",
+  "cedil", "trie;", "bumpe;", "succnsim;", "zeetrf;", "subseteqq;", "nvHarr;", "frac58;", "nsqsupe;", "ohm;", "Igrave;",
+  "osol;", "cylcty;", "it;", "cfr;", "scy;", "xfr;", "lesssim;", "dscr;", "Subset;", "par;", "ETH;", "precsim;",
+  "squarf;", "lnE;", "prurel;", "naturals;", "therefore;", "boxDr;", "vangrt;", "iiota;", "uuarr;", "Utilde;", "langd;",
+  "sccue;", "bsolhsub;", "div;", "KHcy;", "lbbrk;", "ddarr;", "ratail;", "eqvparsl;", "Sscr;", "lopf;",
+  "DoubleLeftArrow;", "leftleftarrows;", "square;", "gescc;", "timesd;", "Beta;", "tritime;", "Bopf;",
+  "CloseCurlyDoubleQuote;", "yen;", "NoBreak;", "HilbertSpace;", "raemptyv;", "zhcy;", "succcurlyeq;", "Cup;", "sung;",
+  "iiiint;", "esdot;", "LeftTeeVector;", "ThinSpace;", "larrsim;", "bne;", "female;", "angst;", "boxtimes;",
+  "RightUpVector;", "Superset;", "Yuml;", "Auml", "sigma;", "triangleright;", "commat;", "leftrightsquigarrow;",
+  "gnapprox;", "vartriangleright;", "IOcy;", "ell;", "Otilde", "PlusMinus;", "xoplus;", "lowbar;", "hookrightarrow;",
+  "rotimes;", "CupCap;", "lAtail;", "xcup;", "geqslant;", "DownLeftVector;", "orarr;", "frown;", "Dopf;", "rsaquo;",
+  "dotsquare;", "Ll;", "iscr;", "Ugrave", "Oacute;", "rmoust;", "nearhk;", "bigotimes;", "gesdot;", "TildeTilde;",
+  "iexcl;", "Fscr;", "Ntilde", "LowerRightArrow;", "rhov;", "RightArrowBar;", "boxVR;", "mp;", "succ;", "Sfr;", "lsim;",
+  "Gamma;", "lobrk;", "Aopf;", "triminus;", "SquareSupersetEqual;", "rarrap;", "bscr;", "ndash;", "or;", "Bumpeq;",
+  "Element;", "dot;", "LeftUpTeeVector;", "ReverseUpEquilibrium;", "subset;", "cups;", "rightleftharpoons;", "ugrave;",
+  "bcong;", "bnot;", "coloneq;", "Euml", "llhard;", "colone;", "lrm;", "ocir;", "supset;", "sim;", "topf;", "simdot;",
+  "larrtl;", "NotReverseElement;", "Hscr;", "maltese;", "SHCHcy;", "nvDash;", "fjlig;", "prime;", "rbarr;", "edot;",
+  "nlArr;", "iuml", "divonx;", "andd;", "lcy;", "eqcirc;", "nabla;", "acirc;", "ultri;", "pluscir;", "UnderBrace;",
+  "tau;", "opar;", "disin;", "COPY;", "RightVector;", "NotEqualTilde;", "ngeq;", "bkarow;", "xodot;", "blk14;", "prop;",
+  "NotLessTilde;", "THORN;", "dashv;", "Uscr;", "Zscr;", "nbsp;", "ni;", "Backslash;", "notin;", "nrarr;", "rnmid;",
+  "Qscr;", "HorizontalLine;", "veebar;", "nparallel;", "precneqq;", "swnwar;", "NotTilde;", "Fopf;", "bowtie;",
+  "hoarr;", "SubsetEqual;", "mdash;", "trade;", "phi;", "vsupnE;", "nvdash;", "period;", "eparsl;", "subrarr;",
+  "curarrm;", "notnivc;", "LT", "HumpDownHump;", "leqq;", "awconint;", "Aring;", "Integral;", "plus;", "gtdot;", "Chi;",
+  "nvgt;", "lesges;", "approxeq;", "plankv;", "laquo", "ngE;", "rtrie;", "iopf;", "Egrave", "Yfr;", "Fcy;", "cent",
+  "vfr;", "amp;", "scaron;", "Qopf;", "ltrif;", "Iuml", "nwarr;", "bigsqcup;", "rbrack;", "rarrlp;", "eta;", "Ecirc",
+  "gnap;", "lceil;", "vartriangleleft;", "cuwed;", "diams;", "RightDownVectorBar;", "Mcy;", "Uacute;", "ratio;",
+  "dblac;", "searr;", "toea;", "circlearrowleft;", "vsubne;", "becaus;", "NotSquareSubsetEqual;", "iquest", "ngsim;",
+  "AElig", "nhArr;", "phone;", "Oslash", "triangleq;", "angzarr;", "reals;", "gt", "CircleDot;", "numero;", "boxHu;",
+  "bigvee;", "Ccedil", "oS;", "uhblk;", "lbarr;", "ccirc;", "Tau;", "dArr;", "Scedil;", "puncsp;", "rarrpl;",
+  "intercal;", "preccurlyeq;", "suphsol;", "trisb;", "iogon;", "Aring", "Gbreve;", "drcorn;", "ddagger;",
+  "LeftDoubleBracket;", "risingdotseq;", "dtrif;", "reg;", "mu;", "Jcy;", "Sqrt;", "tdot;", "cudarrl;", "Ncaron;",
+  "iiint;", "apE;", "pm;", "nvinfin;", "aacute", "ngtr;", "thorn", "bsemi;", "atilde;", "wedgeq;", "SucceedsEqual;",
+  "Kcedil;", "xhArr;", "subedot;", "bigtriangleup;", "natur;", "boxHd;", "wp;", "cuvee;", "gacute;", "Popf;", "Iscr;",
+  "SquareSubsetEqual;", "ReverseElement;", "pound", "dHar;", "emsp;", "lArr;", "aelig;", "itilde;", "lopar;", "gdot;",
+  "varsubsetneqq;", "npreceq;", "Vdash;", "frasl;", "TildeEqual;", "subdot;", "yscr;", "Longleftarrow;", "precapprox;",
+  "lvertneqq;", "Bernoullis;", "jmath;", "middot", "varsupsetneq;", "RightUpVectorBar;", "Gammad;", "ecirc;",
+  "NotExists;", "nGt;", "wscr;", "fllig;", "RightTriangleBar;", "nleftarrow;", "Ubreve;", "nvlt;", "longleftarrow;",
+  "upuparrows;", "DD;", "omicron;", "subsub;", "hearts;", "vsubnE;", "jukcy;", "Uparrow;", "asympeq;", "xscr;",
+  "NotEqual;", "larr;", "realpart;", "UnionPlus;", "LowerLeftArrow;", "rsqb;", "OverParenthesis;", "exist;", "gla;",
+  "star;", "rang;", "jcirc;", "dfr;", "late;", "npr;", "nVdash;", "nles;", "fpartint;", "DownTee;", "YAcy;", "rscr;",
+  "otimes;", "lBarr;", "TildeFullEqual;", "Oacute", "iota;", "nle;", "hellip;", "gtquest;", "Tcy;", "isins;", "capdot;",
+  "ntrianglelefteq;", "lesseqgtr;", "SucceedsTilde;", "natural;", "pr;", "urcorner;", "nvle;", "RightUpDownVector;",
+  "timesb;", "DoubleUpArrow;", "quest;", "Amacr;", "NotSquareSubset;", "ugrave", "nopf;", "qopf;", "nexist;",
+  "angmsdah;", "gsiml;", "Vscr;", "perp;", "DoubleVerticalBar;", "image;", "Oopf;", "lozf;", "boxHD;", "Atilde;",
+  "srarr;", "AMP", "spades;", "rthree;", "iacute", "rhard;", "aleph;", "atilde", "lpar;", "kgreen;", "weierp;", "gsim;",
+  "sect", "PrecedesEqual;", "DownRightTeeVector;", "diamondsuit;", "ffilig;", "npre;", "pluse;", "angmsdaf;", "oacute;",
+  "DoubleRightArrow;", "supmult;", "Ugrave;", "GreaterGreater;", "parsim;", "radic;", "NotPrecedesSlantEqual;",
+  "nleqq;", "notinvc;", "frac12;", "sfrown;", "rpar;", "vnsup;", "Sopf;", "kfr;", "NotSucceedsEqual;", "lates;", "Ffr;",
+  "Lacute;", "lsime;", "aogon;", "hercon;", "npar;", "NotTildeFullEqual;", "smile;", "Ncedil;", "upharpoonright;",
+  "primes;", "neArr;", "OverBar;", "LessGreater;", "LeftUpVector;", "nparsl;", "jsercy;", "Vopf;", "yen", "supplus;",
+  "micro;", "gtlPar;", "Rarrtl;", "minusdu;", "Map;", "plustwo;", "simeq;", "boxdl;", "xopf;", "Nscr;", "LT;",
+  "UpTeeArrow;", "bigstar;", "erarr;", "loz;", "amalg;", "gtcir;", "yacute;", "Rarr;", "lesseqqgtr;", "uacute;",
+  "upsi;", "NotGreaterLess;", "zigrarr;", "fork;", "fcy;", "Cedilla;", "nscr;", "Ecy;", "gg;", "succnapprox;", "euml;",
+  "NotGreaterEqual;", "thetasym;", "SuchThat;", "boxUL;", "frac34", "RightTeeArrow;", "NotPrecedes;", "notinvb;",
+  "Darr;", "LongLeftRightArrow;", "Iacute;", "nvlArr;", "Acirc", "uogon;", "oint;", "Nu;", "GreaterSlantEqual;",
+  "uopf;", "equivDD;", "cedil;", "Xfr;", "subE;", "nprec;", "ordm;", "NegativeThickSpace;", "yacy;", "pound;",
+  "subsetneqq;", "rightarrow;", "Lstrok;", "Auml;", "cudarrr;", "hksearow;", "Dstrok;", "DifferentialD;", "Because;",
+  "Yopf;", "lnapprox;", "Proportional;", "sdotb;", "NegativeVeryThinSpace;", "frac38;", "lesdoto;", "Emacr;", "boxvh;",
+  "LeftArrowBar;", "NotGreaterFullEqual;", "Zopf;", "ap;", "UpperLeftArrow;", "zcaron;", "rharu;", "supdsub;", "Uarr;",
+  "IEcy;", "fflig;", "kjcy;", "map;", "GreaterEqualLess;", "IJlig;", "setmn;", "pfr;", "bsim;", "downarrow;", "ijlig;",
+  "succapprox;", "Gcirc;", "Idot;", "dollar;", "nleq;", "omid;", "szlig;", "Ocy;", "iff;", "Alpha;", "napE;", "Gfr;",
+  "boxul;", "Sacute;", "sup;", "NotSucceeds;", "Sigma;", "ncongdot;", "shy;", "ubrcy;", "omacr;", "boxminus;", "equiv;",
+  "RightFloor;", "agrave", "ograve;", "lowast;", "Gt;", "yfr;", "Square;", "NestedLessLess;", "Congruent;", "iprod;",
+  "cirmid;", "male;", "vnsub;", "mfr;", "varpi;", "Ropf;", "vopf;", "Rscr;", "deg;", "succsim;", "hybull;", "Cscr;",
+  "Nfr;", "olcir;", "solb;", "ac;", "uArr;", "upsih;", "oopf;", "epsiv;", "nbumpe;", "longleftrightarrow;", "dscy;",
+  "Iogon;", "ENG;", "lsqb;", "ouml;", "uring;", "uscr;", "cupor;", "icy;", "supe;", "sube;", "ngeqslant;",
+  "NonBreakingSpace;", "nu;", "lharul;", "capcap;", "dharr;", "prnE;", "Afr;", "Poincareplane;", "Edot;", "nsim;",
+  "nwArr;", "plusb;", "blk12;", "ltrPar;", "LessFullEqual;", "ubreve;", "blacktriangleright;", "Lt;",
+  "NestedGreaterGreater;", "ape;", "RightTee;", "boxvr;", "mnplus;", "cwint;", "lsquo;", "dcaron;", "lbrkslu;",
+  "iinfin;", "DoubleLongLeftArrow;", "Lcedil;", "acy;", "nGg;", "sup3", "varsubsetneq;", "rAtail;", "LessEqualGreater;",
+  "LJcy;", "squ;", "SquareSuperset;", "pointint;", "ccedil;", "precnapprox;", "cupcap;", "spadesuit;", "Aacute;",
+  "abreve;", "kappa;", "Eacute", "conint;", "profalar;", "fnof;", "imagline;", "midast;", "Hat;",
+  "DoubleLongLeftRightArrow;", "sqcaps;", "csub;", "xlarr;", "para", "num;", "doteq;", "zscr;", "ncy;", "loplus;",
+  "Wcirc;", "lt", "gt;", "lharu;", "lsimg;", "Coproduct;", "dagger;", "infin;", "Star;", "dlcorn;", "nsubseteq;",
+  "ecirc", "raquo", "prE;", "piv;", "cscr;", "dtdot;", "LongLeftArrow;", "escr;", "longmapsto;", "rtri;",
+  "hookleftarrow;", "int;", "aopf;", "Sub;", "deg", "ExponentialE;", "wfr;", "PrecedesTilde;", "rBarr;", "lambda;",
+  "LessSlantEqual;", "ominus;", "Gdot;", "cir;", "isindot;", "gsime;", "ncaron;", "dwangle;", "frac16;", "Ycy;",
+  "thkap;", "NotElement;", "loarr;", "Jopf;", "lt;", "succeq;", "esim;", "not", "napid;", "simgE;", "ogt;",
+  "NotLeftTriangleBar;", "boxVL;", "Ccirc;", "nbump;", "EmptySmallSquare;", "in;", "UpEquilibrium;", "lotimes;",
+  "tprime;", "Diamond;", "supne;", "AMP;",
+};
+
+// One or two code points for each slot, with 0 for none
+static const uint32_t html_entity_code_points[2231][2] = {
+  {0x12A, 0x0}, {0x2102, 0x0}, {0x2265, 0x0}, {0x21C6, 0x0}, {0x153, 0x0}, {0x169, 0x0}, {0xFC, 0x0}, {0x2A37, 0x0},
+  {0x2315, 0x0}, {0x21BA, 0x0}, {0x2A16, 0x0}, {0x22B2, 0x0}, {0x2025, 0x0}, {0x225F, 0x0}, {0x226F, 0x0}, {0xC2, 0x0},
+  {0xDC, 0x0}, {0x228A, 0x0}, {0x13F, 0x0}, {0x142, 0x0}, {0xAC, 0x0}, {0x27ED, 0x0}, {0x17D, 0x0}, {0x221D, 0x0},
+  {0x2AC5, 0x338}, {0x29A7, 0x0}, {0x394, 0x0}, {0xFA, 0x0}, {0x210F, 0x0}, {0x21C0, 0x0}, {0x2A85, 0x0}, {0x2063, 0x0},
+  {0x102, 0x0}, {0x1D537, 0x0}, {0x255A, 0x0}, {0x2A83, 0x0}, {0x10D, 0x0}, {0xA1, 0x0}, {0x21CA, 0x0}, {0x210D, 0x0},
+  {0x22EA, 0x0}, {0x457, 0x0}, {0x2269, 0xFE00}, {0x1D50D, 0x0}, {0x231F, 0x0}, {0x2196, 0x0}, {0x151, 0x0},
+  {0x2DC, 0x0}, {0xE5, 0x0}, {0x443, 0x0}, {0x21C3, 0x0}, {0x3F6, 0x0}, {0x2002, 0x0}, {0x22EB, 0x0}, {0x23B0, 0x0},
+  {0x7B, 0x0}, {0x1D4C8, 0x0}, {0xD5, 0x0}, {0x2AAF, 0x0}, {0x3D5, 0x0}, {0x2956, 0x0}, {0x2102, 0x0}, {0x3A0, 0x0},
+  {0x25FA, 0x0}, {0x1D4B2, 0x0}, {0x291D, 0x0}, {0xF4, 0x0}, {0x1D4CB, 0x0}, {0x223C, 0x0}, {0x22D5, 0x0},
+  {0x2A95, 0x0}, {0x2294, 0x0}, {0x3A, 0x0}, {0x2136, 0x0}, {0x2265, 0x0}, {0x22A3, 0x0}, {0xAB, 0x0}, {0x2950, 0x0},
+  {0x2C6, 0x0}, {0x118, 0x0}, {0x2A87, 0x0}, {0x158, 0x0}, {0xB9, 0x0}, {0x23B4, 0x0}, {0x2A00, 0x0}, {0x21C4, 0x0},
+  {0x29B4, 0x0}, {0x223E, 0x0}, {0x29C3, 0x0}, {0x2273, 0x0}, {0x2193, 0x0}, {0x25AA, 0x0}, {0x16B, 0x0}, {0x222E, 0x0},
+  {0xF3, 0x0}, {0x107, 0x0}, {0x2063, 0x0}, {0xF6, 0x0}, {0x223F, 0x0}, {0x2061, 0x0}, {0x2AE7, 0x0}, {0x21B6, 0x0},
+  {0x131, 0x0}, {0x1D556, 0x0}, {0x21E5, 0x0}, {0x7D, 0x0}, {0x1D52F, 0x0}, {0x27F6, 0x0}, {0x21C1, 0x0}, {0x27F9, 0x0},
+  {0x2AD3, 0x0}, {0x2191, 0x0}, {0x10E, 0x0}, {0x3D1, 0x0}, {0x222F, 0x0}, {0x21B5, 0x0}, {0x3C2, 0x0}, {0xA0, 0x0},
+  {0x22BA, 0x0}, {0x2928, 0x0}, {0x2267, 0x338}, {0x22A5, 0x0}, {0x224D, 0x20D2}, {0x3B5, 0x0}, {0x2191, 0x0},
+  {0x1D559, 0x0}, {0x23B5, 0x0}, {0x2294, 0x0}, {0x2A7D, 0x0}, {0x22EB, 0x0}, {0xFB, 0x0}, {0xE2, 0x0}, {0x2A55, 0x0},
+  {0x22B5, 0x0}, {0xF0, 0x0}, {0xFB, 0x0}, {0x2A84, 0x0}, {0x2158, 0x0}, {0x2AB0, 0x0}, {0x22B3, 0x0}, {0x2D9, 0x0},
+  {0x2A10, 0x0}, {0x39F, 0x0}, {0x256C, 0x0}, {0x2041, 0x0}, {0x2262, 0x0}, {0x2007, 0x0}, {0x25C3, 0x0}, {0x163, 0x0},
+  {0x2AEB, 0x0}, {0x2584, 0x0}, {0x27F9, 0x0}, {0x22BF, 0x0}, {0x39E, 0x0}, {0x2218, 0x0}, {0x2287, 0x0}, {0x22B3, 0x0},
+  {0x2A85, 0x0}, {0x21C5, 0x0}, {0x23B1, 0x0}, {0x2AAA, 0x0}, {0x2247, 0x0}, {0x2713, 0x0}, {0x22C3, 0x0}, {0xFE, 0x0},
+  {0x226A, 0x338}, {0x290F, 0x0}, {0x27E8, 0x0}, {0x2AD0, 0x0}, {0x2275, 0x0}, {0x1D519, 0x0}, {0x21A9, 0x0},
+  {0x21A4, 0x0}, {0x2278, 0x0}, {0x2A06, 0x0}, {0x2009, 0x0}, {0x2035, 0x0}, {0x2AB6, 0x0}, {0x220F, 0x0},
+  {0x22FB, 0x0}, {0x1D4C1, 0x0}, {0x2AB7, 0x0}, {0x296E, 0x0}, {0x2192, 0x0}, {0x1D529, 0x0}, {0x41A, 0x0}, {0xD2, 0x0},
+  {0x2213, 0x0}, {0x176, 0x0}, {0x21C3, 0x0}, {0x2245, 0x0}, {0x1D507, 0x0}, {0x2019, 0x0}, {0x22F0, 0x0},
+  {0x2205, 0x0}, {0x25EC, 0x0}, {0x7C, 0x0}, {0x2223, 0x0}, {0x2252, 0x0}, {0x227C, 0x0}, {0x423, 0x0}, {0x149, 0x0},
+  {0x226A, 0x20D2}, {0x2145, 0x0}, {0x2AC5, 0x338}, {0x2A54, 0x0}, {0x2267, 0x0}, {0x22DB, 0x0}, {0xFF, 0x0},
+  {0xD2, 0x0}, {0x210F, 0x0}, {0x1D553, 0x0}, {0x210B, 0x0}, {0x456, 0x0}, {0xB1, 0x0}, {0x1D4AA, 0x0}, {0xA9, 0x0},
+  {0x2A7B, 0x0}, {0x420, 0x0}, {0x22C6, 0x0}, {0x22E6, 0x0}, {0x2323, 0x0}, {0x2276, 0x0}, {0x22EC, 0x0},
+  {0x223E, 0x333}, {0x2282, 0x20D2}, {0x2A2E, 0x0}, {0x410, 0x0}, {0x1D50E, 0x0}, {0x223C, 0x0}, {0x295D, 0x0},
+  {0x2A, 0x0}, {0x1D52B, 0x0}, {0x1D4B6, 0x0}, {0xEB, 0x0}, {0x2927, 0x0}, {0x21DA, 0x0}, {0x1B5, 0x0}, {0xE4, 0x0},
+  {0x2AB9, 0x0}, {0x2227, 0x0}, {0x221F, 0x0}, {0x222F, 0x0}, {0xBC, 0x0}, {0x2282, 0x20D2}, {0xAF, 0x0}, {0xC3, 0x0},
+  {0x2976, 0x0}, {0x16A, 0x0}, {0x27F7, 0x0}, {0x215A, 0x0}, {0x21D5, 0x0}, {0x2267, 0x0}, {0x2A88, 0x0}, {0x2A53, 0x0},
+  {0x29A4, 0x0}, {0x165, 0x0}, {0x2201, 0x0}, {0x159, 0x0}, {0x221D, 0x0}, {0x2500, 0x0}, {0x22CC, 0x0}, {0x201D, 0x0},
+  {0x2925, 0x0}, {0xB1, 0x0}, {0x2204, 0x0}, {0x22D2, 0x0}, {0x2717, 0x0}, {0x2316, 0x0}, {0x29B1, 0x0}, {0xDA, 0x0},
+  {0x219D, 0x338}, {0x2221, 0x0}, {0x2117, 0x0}, {0x22B8, 0x0}, {0x1D568, 0x0}, {0x212C, 0x0}, {0x41F, 0x0},
+  {0x122, 0x0}, {0xEE, 0x0}, {0x1D523, 0x0}, {0x27EA, 0x0}, {0x22B2, 0x0}, {0x21F5, 0x0}, {0x1D518, 0x0}, {0xA8, 0x0},
+  {0x29B2, 0x0}, {0x2192, 0x0}, {0x101, 0x0}, {0x226E, 0x0}, {0x22E9, 0x0}, {0x231E, 0x0}, {0x3D, 0x0}, {0x416, 0x0},
+  {0x2A49, 0x0}, {0x2309, 0x0}, {0x2290, 0x338}, {0x223D, 0x331}, {0x2291, 0x0}, {0x408, 0x0}, {0x2283, 0x20D2},
+  {0x2154, 0x0}, {0x22CB, 0x0}, {0xB7, 0x0}, {0x43F, 0x0}, {0x22D9, 0x0}, {0x1D54C, 0x0}, {0x2265, 0x20D2},
+  {0x228F, 0x0}, {0x2AC8, 0x0}, {0x219D, 0x0}, {0x421, 0x0}, {0x2130, 0x0}, {0x2A13, 0x0}, {0x200F, 0x0}, {0x2019, 0x0},
+  {0x2253, 0x0}, {0x2A73, 0x0}, {0x21CD, 0x0}, {0x25EF, 0x0}, {0x2AE6, 0x0}, {0x1D563, 0x0}, {0x21BC, 0x0}, {0x60, 0x0},
+  {0x21A4, 0x0}, {0x39C, 0x0}, {0x2192, 0x0}, {0x296D, 0x0}, {0x2242, 0x338}, {0x25B3, 0x0}, {0x2A11, 0x0},
+  {0x2AC6, 0x0}, {0xA8, 0x0}, {0x2929, 0x0}, {0x146, 0x0}, {0x22AA, 0x0}, {0x22A8, 0x0}, {0xB7, 0x0}, {0x211C, 0x0},
+  {0x233D, 0x0}, {0x2AAF, 0x0}, {0x2A58, 0x0}, {0x113, 0x0}, {0x25B8, 0x0}, {0x2A6F, 0x0}, {0x27E9, 0x0}, {0x2223, 0x0},
+  {0x21C3, 0x0}, {0x2AAC, 0xFE00}, {0x414, 0x0}, {0x2A9F, 0x0}, {0x2910, 0x0}, {0x22CE, 0x0}, {0x27F6, 0x0},
+  {0x21A7, 0x0}, {0x407, 0x0}, {0x2291, 0x0}, {0x21B1, 0x0}, {0x2A4C, 0x0}, {0x431, 0x0}, {0x2285, 0x0}, {0x212C, 0x0},
+  {0x23E7, 0x0}, {0xBF, 0x0}, {0x22DF, 0x0}, {0x29B5, 0x0}, {0x143, 0x0}, {0x296F, 0x0}, {0x2033, 0x0}, {0x21B1, 0x0},
+  {0x227D, 0x0}, {0x175, 0x0}, {0x29D0, 0x338}, {0x2A5A, 0x0}, {0x2DC, 0x0}, {0x201D, 0x0}, {0x2237, 0x0}, {0x3D5, 0x0},
+  {0xF1, 0x0}, {0x2220, 0x0}, {0x250C, 0x0}, {0x2278, 0x0}, {0x2A7D, 0x338}, {0x2223, 0x0}, {0x15C, 0x0}, {0x3C7, 0x0},
+  {0x2010, 0x0}, {0x25B4, 0x0}, {0x27F6, 0x0}, {0x3BE, 0x0}, {0x2A9E, 0x0}, {0x14B, 0x0}, {0x2266, 0x0}, {0x2216, 0x0},
+  {0x2250, 0x0}, {0x2970, 0x0}, {0x2200, 0x0}, {0xCF, 0x0}, {0x22EE, 0x0}, {0x27F8, 0x0}, {0x294B, 0x0}, {0x22C0, 0x0},
+  {0x27E7, 0x0}, {0x2A71, 0x0}, {0x171, 0x0}, {0x229D, 0x0}, {0x256B, 0x0}, {0x417, 0x0}, {0x21B0, 0x0}, {0x25FC, 0x0},
+  {0x2AB0, 0x338}, {0x2967, 0x0}, {0x21C9, 0x0}, {0x21CB, 0x0}, {0x3B1, 0x0}, {0x228E, 0x0}, {0x2AD1, 0x0},
+  {0x2281, 0x0}, {0x1D51A, 0x0}, {0x2A12, 0x0}, {0x2290, 0x0}, {0x27, 0x0}, {0x2274, 0x0}, {0x223D, 0x0}, {0x2AB6, 0x0},
+  {0x2A77, 0x0}, {0x396, 0x0}, {0x17B, 0x0}, {0x297B, 0x0}, {0x21B2, 0x0}, {0x21DB, 0x0}, {0x2A56, 0x0}, {0x21C1, 0x0},
+  {0x449, 0x0}, {0xCE, 0x0}, {0x2A24, 0x0}, {0x2DD, 0x0}, {0xA, 0x0}, {0x2AAB, 0x0}, {0x2910, 0x0}, {0x2949, 0x0},
+  {0x1D50F, 0x0}, {0x2A89, 0x0}, {0xA8, 0x0}, {0x2262, 0x0}, {0x224F, 0x0}, {0xDB, 0x0}, {0x2211, 0x0}, {0xAE, 0x0},
+  {0x1D53E, 0x0}, {0x3F1, 0x0}, {0xB4, 0x0}, {0x2202, 0x338}, {0x296C, 0x0}, {0x230A, 0x0}, {0x212D, 0x0}, {0x433, 0x0},
+  {0x205F, 0x0}, {0x2260, 0x0}, {0x2226, 0x0}, {0x25CA, 0x0}, {0x22FC, 0x0}, {0x1D526, 0x0}, {0x1D530, 0x0},
+  {0x2978, 0x0}, {0x3F5, 0x0}, {0x200A, 0x0}, {0xE4, 0x0}, {0xDD, 0x0}, {0xA4, 0x0}, {0xE9, 0x0}, {0x2199, 0x0},
+  {0x1D557, 0x0}, {0x3F5, 0x0}, {0xD6, 0x0}, {0x2DA, 0x0}, {0xCB, 0x0}, {0x294E, 0x0}, {0x29BC, 0x0}, {0x1D4A6, 0x0},
+  {0x21D3, 0x0}, {0x2A96, 0x0}, {0x201A, 0x0}, {0x2312, 0x0}, {0x3C2, 0x0}, {0x229B, 0x0}, {0x224E, 0x0},
+  {0x1D4C0, 0x0}, {0xF2, 0x0}, {0x2552, 0x0}, {0x2A38, 0x0}, {0xD6, 0x0}, {0x21C2, 0x0}, {0x447, 0x0}, {0x21CC, 0x0},
+  {0x2128, 0x0}, {0x21BF, 0x0}, {0x22DB, 0x0}, {0x1D52E, 0x0}, {0x150, 0x0}, {0x2AE4, 0x0}, {0x22F5, 0x338},
+  {0x219B, 0x0}, {0x2A87, 0x0}, {0x2565, 0x0}, {0x2035, 0x0}, {0x3A6, 0x0}, {0x2AA1, 0x0}, {0x2A79, 0x0}, {0x20DB, 0x0},
+  {0x2313, 0x0}, {0xEF, 0x0}, {0x221D, 0x0}, {0x451, 0x0}, {0xDE, 0x0}, {0x1D555, 0x0}, {0x2A29, 0x0}, {0x22EB, 0x0},
+  {0x21D5, 0x0}, {0x2561, 0x0}, {0x295B, 0x0}, {0x2261, 0x20E5}, {0x3C2, 0x0}, {0x21D0, 0x0}, {0x22DA, 0x0},
+  {0x10B, 0x0}, {0x22ED, 0x0}, {0x39B, 0x0}, {0x13A, 0x0}, {0x3B6, 0x0}, {0x2AD7, 0x0}, {0x228F, 0x0}, {0x2146, 0x0},
+  {0x2296, 0x0}, {0x445, 0x0}, {0x2A42, 0x0}, {0x5C, 0x0}, {0x125, 0x0}, {0x2039, 0x0}, {0xAD, 0x0}, {0x220F, 0x0},
+  {0x2246, 0x0}, {0x2554, 0x0}, {0x21B7, 0x0}, {0x3A1, 0x0}, {0xD0, 0x0}, {0x2220, 0x20D2}, {0xB4, 0x0}, {0x11B, 0x0},
+  {0x27EB, 0x0}, {0x2289, 0x0}, {0x1D544, 0x0}, {0xAE, 0x0}, {0x233F, 0x0}, {0x2308, 0x0}, {0xE7, 0x0}, {0x21, 0x0},
+  {0x22DE, 0x0}, {0x2961, 0x0}, {0x2201, 0x0}, {0x2936, 0x0}, {0x219D, 0x0}, {0x2269, 0x0}, {0x12B, 0x0}, {0x25BF, 0x0},
+  {0xF5, 0x0}, {0x27E8, 0x0}, {0xF7, 0x0}, {0x2226, 0x0}, {0x1D561, 0x0}, {0x22FA, 0x0}, {0x42C, 0x0}, {0x231D, 0x0},
+  {0x2968, 0x0}, {0x44E, 0x0}, {0x22F9, 0x0}, {0x2249, 0x0}, {0x2A01, 0x0}, {0x2A7F, 0x0}, {0xF8, 0x0}, {0x2252, 0x0},
+  {0x1D56B, 0x0}, {0x1D55C, 0x0}, {0x27FF, 0x0}, {0x2190, 0x0}, {0x21A0, 0x0}, {0x22E7, 0x0}, {0x21D4, 0x0},
+  {0x11D, 0x0}, {0x2AD9, 0x0}, {0xFB04, 0x0}, {0x20AC, 0x0}, {0x255F, 0x0}, {0xE5, 0x0}, {0x7D, 0x0}, {0x29F4, 0x0},
+  {0x22C5, 0x0}, {0x2295, 0x0}, {0x2A17, 0x0}, {0x230F, 0x0}, {0x2228, 0x0}, {0xE0, 0x0}, {0x1D508, 0x0}, {0x22C1, 0x0},
+  {0x442, 0x0}, {0x3B3, 0x0}, {0x2211, 0x0}, {0x3C9, 0x0}, {0x1D514, 0x0}, {0x2242, 0x0}, {0x7C, 0x0}, {0x2234, 0x0},
+  {0x22E8, 0x0}, {0x252C, 0x0}, {0x2148, 0x0}, {0x21AD, 0x0}, {0x2958, 0x0}, {0x177, 0x0}, {0x21D8, 0x0}, {0x399, 0x0},
+  {0x21AC, 0x0}, {0x200D, 0x0}, {0x2282, 0x0}, {0x226A, 0x338}, {0x27FA, 0x0}, {0x2244, 0x0}, {0x411, 0x0},
+  {0x211B, 0x0}, {0x2AA1, 0x338}, {0xC0, 0x0}, {0x2A0C, 0x0}, {0xA8, 0x0}, {0x155, 0x0}, {0x2057, 0x0}, {0x2534, 0x0},
+  {0x15F, 0x0}, {0x21C2, 0x0}, {0x27EC, 0x0}, {0x27F9, 0x0}, {0x299A, 0x0}, {0x21D2, 0x0}, {0x2AE4, 0x0}, {0x29C2, 0x0},
+  {0x2222, 0x0}, {0x25BD, 0x0}, {0x298F, 0x0}, {0x3B8, 0x0}, {0x179, 0x0}, {0x2205, 0x0}, {0x23B5, 0x0}, {0xE1, 0x0},
+  {0x3B5, 0x0}, {0x22A4, 0x0}, {0x2208, 0x0}, {0x211C, 0x0}, {0x21DB, 0x0}, {0x2218, 0x0}, {0x2016, 0x0}, {0x23B4, 0x0},
+  {0x1D4C9, 0x0}, {0x229E, 0x0}, {0x2A8C, 0x0}, {0x1D51E, 0x0}, {0x223C, 0x20D2}, {0x2287, 0x0}, {0x2135, 0x0},
+  {0x2990, 0x0}, {0x2230, 0x0}, {0xAA, 0x0}, {0x29EB, 0x0}, {0x2255, 0x0}, {0x1D4C5, 0x0}, {0x13D, 0x0}, {0x45A, 0x0},
+  {0xAE, 0x0}, {0x22B8, 0x0}, {0x23B0, 0x0}, {0xBA, 0x0}, {0x2004, 0x0}, {0x22A2, 0x0}, {0x22D6, 0x0}, {0x1D4C2, 0x0},
+  {0x2972, 0x0}, {0x2A74, 0x0}, {0xCC, 0x0}, {0x2031, 0x0}, {0x43A, 0x0}, {0x25C3, 0x0}, {0x2A6E, 0x0}, {0x22A5, 0x0},
+  {0x21B0, 0x0}, {0x15D, 0x0}, {0x21CB, 0x0}, {0x2248, 0x0}, {0xB2, 0x0}, {0x2A04, 0x0}, {0x453, 0x0}, {0x2224, 0x0},
+  {0xBD, 0x0}, {0x2AC7, 0x0}, {0x220B, 0x0}, {0x2A02, 0x0}, {0x2A77, 0x0}, {0x2200, 0x0}, {0x2264, 0x0}, {0x256A, 0x0},
+  {0xF8, 0x0}, {0x21AE, 0x0}, {0xE9, 0x0}, {0x2190, 0x0}, {0x2254, 0x0}, {0x1D531, 0x0}, {0x2191, 0x0}, {0x10A, 0x0},
+  {0x255C, 0x0}, {0x2AEC, 0x0}, {0x2195, 0x0}, {0x2005, 0x0}, {0x21C6, 0x0}, {0x1D540, 0x0}, {0x60, 0x0}, {0x22A8, 0x0},
+  {0x2DB, 0x0}, {0x2284, 0x0}, {0xAF, 0x0}, {0x21A5, 0x0}, {0x2194, 0x0}, {0x1D49C, 0x0}, {0x2134, 0x0}, {0x22D6, 0x0},
+  {0x2937, 0x0}, {0x1D55B, 0x0}, {0x2974, 0x0}, {0x446, 0x0}, {0x2758, 0x0}, {0x2212, 0x0}, {0x2AA7, 0x0},
+  {0x223C, 0x0}, {0x27E9, 0x0}, {0xA6, 0x0}, {0x7B, 0x0}, {0xAA, 0x0}, {0x21BE, 0x0}, {0x2A43, 0x0}, {0x2022, 0x0},
+  {0x1D524, 0x0}, {0x22B4, 0x0}, {0x3C8, 0x0}, {0x13C, 0x0}, {0x439, 0x0}, {0x2ACC, 0xFE00}, {0x3C0, 0x0}, {0x3B, 0x0},
+  {0x40A, 0x0}, {0x2912, 0x0}, {0x226A, 0x0}, {0x45F, 0x0}, {0x22E3, 0x0}, {0x1D4A5, 0x0}, {0x1D543, 0x0}, {0xBC, 0x0},
+  {0x22D9, 0x0}, {0x17C, 0x0}, {0x21BC, 0x0}, {0x219E, 0x0}, {0x201E, 0x0}, {0x427, 0x0}, {0x134, 0x0}, {0x2993, 0x0},
+  {0x2010, 0x0}, {0x43C, 0x0}, {0x2306, 0x0}, {0x45B, 0x0}, {0xED, 0x0}, {0x1D522, 0x0}, {0x21C5, 0x0}, {0x229B, 0x0},
+  {0x22B5, 0x20D2}, {0x21A6, 0x0}, {0x2A33, 0x0}, {0x2030, 0x0}, {0x25AB, 0x0}, {0x2569, 0x0}, {0x22DE, 0x0},
+  {0x220C, 0x0}, {0x22E1, 0x0}, {0x21D2, 0x0}, {0x2ABA, 0x0}, {0x25, 0x0}, {0x2514, 0x0}, {0x29A8, 0x0}, {0x2195, 0x0},
+  {0x3B4, 0x0}, {0x2251, 0x0}, {0x157, 0x0}, {0xC6, 0x0}, {0x299D, 0x0}, {0x22D4, 0x0}, {0x211A, 0x0}, {0x25AE, 0x0},
+  {0x21A2, 0x0}, {0x11F, 0x0}, {0x2605, 0x0}, {0x21AE, 0x0}, {0x21C4, 0x0}, {0x2AC6, 0x0}, {0x1D55E, 0x0},
+  {0x2019, 0x0}, {0x2111, 0x0}, {0x14C, 0x0}, {0x3F0, 0x0}, {0x22B5, 0x0}, {0x230E, 0x0}, {0x2AD6, 0x0}, {0x2226, 0x0},
+  {0x2AC1, 0x0}, {0xBD, 0x0}, {0x2A8C, 0x0}, {0x1D52C, 0x0}, {0xB4, 0x0}, {0x298E, 0x0}, {0x22ED, 0x0}, {0x2112, 0x0},
+  {0x2197, 0x0}, {0x1D4BB, 0x0}, {0x2195, 0x0}, {0x162, 0x0}, {0x2C, 0x0}, {0x160, 0x0}, {0x255E, 0x0}, {0x23B6, 0x0},
+  {0x22D8, 0x338}, {0x3F0, 0x0}, {0x210C, 0x0}, {0x2111, 0x0}, {0x224B, 0x0}, {0x29BB, 0x0}, {0x2A8B, 0x0},
+  {0x22AF, 0x0}, {0x2243, 0x0}, {0x39A, 0x0}, {0x211E, 0x0}, {0x2F, 0x0}, {0x226C, 0x0}, {0x2926, 0x0}, {0x227A, 0x0},
+  {0x2289, 0x0}, {0x2270, 0x0}, {0x2A75, 0x0}, {0xFC, 0x0}, {0xB9, 0x0}, {0x2133, 0x0}, {0xEC, 0x0}, {0x2122, 0x0},
+  {0x29BF, 0x0}, {0x2197, 0x0}, {0x21C4, 0x0}, {0x21BD, 0x0}, {0x297C, 0x0}, {0x2271, 0x0}, {0x293D, 0x0},
+  {0x222A, 0x0}, {0x21A3, 0x0}, {0x29AA, 0x0}, {0x3F6, 0x0}, {0xAE, 0x0}, {0x2A95, 0x0}, {0x294A, 0x0}, {0x21AB, 0x0},
+  {0x2153, 0x0}, {0x426, 0x0}, {0x2210, 0x0}, {0x2ACB, 0x0}, {0x2AE8, 0x0}, {0x23E2, 0x0}, {0x2227, 0x0}, {0x428, 0x0},
+  {0x137, 0x0}, {0x21D3, 0x0}, {0x2127, 0x0}, {0x210E, 0x0}, {0x22B4, 0x0}, {0x164, 0x0}, {0x22CF, 0x0}, {0x26, 0x0},
+  {0x224F, 0x338}, {0x2A86, 0x0}, {0xC9, 0x0}, {0x5F, 0x0}, {0x21F5, 0x0}, {0x29B0, 0x0}, {0x2240, 0x0}, {0x297D, 0x0},
+  {0x2557, 0x0}, {0x2568, 0x0}, {0x2244, 0x0}, {0xB5, 0x0}, {0x2249, 0x0}, {0x2558, 0x0}, {0x2ABE, 0x0}, {0x3D2, 0x0},
+  {0x2ADA, 0x0}, {0x29A5, 0x0}, {0x2969, 0x0}, {0x2963, 0x0}, {0x29AC, 0x0}, {0x1D54E, 0x0}, {0x226D, 0x0},
+  {0x2130, 0x0}, {0x1D51F, 0x0}, {0x22DF, 0x0}, {0x2ADB, 0x0}, {0x2266, 0x338}, {0x2240, 0x0}, {0x434, 0x0},
+  {0x2913, 0x0}, {0x298C, 0x0}, {0x21D9, 0x0}, {0x22E0, 0x0}, {0x2021, 0x0}, {0x227A, 0x0}, {0x2232, 0x0},
+  {0x2AF0, 0x0}, {0x29AB, 0x0}, {0x2A94, 0x0}, {0x29C0, 0x0}, {0x405, 0x0}, {0xB2, 0x0}, {0xE6, 0x0}, {0x22, 0x0},
+  {0x22BE, 0x0}, {0x2240, 0x0}, {0x22C0, 0x0}, {0x25AA, 0x0}, {0x2ACC, 0x0}, {0x2992, 0x0}, {0x21CE, 0x0}, {0x448, 0x0},
+  {0x227E, 0x0}, {0x224F, 0x0}, {0x2134, 0x0}, {0x2951, 0x0}, {0x11A, 0x0}, {0x22EA, 0x0}, {0x2911, 0x0}, {0x222C, 0x0},
+  {0x413, 0x0}, {0x2193, 0x0}, {0x2111, 0x0}, {0x24C8, 0x0}, {0x25F9, 0x0}, {0x22C2, 0x0}, {0x228F, 0x0},
+  {0x1D4AF, 0x0}, {0x29B9, 0x0}, {0x22DB, 0xFE00}, {0x2288, 0x0}, {0x21C6, 0x0}, {0x21DA, 0x0}, {0x2018, 0x0},
+  {0x2147, 0x0}, {0x2A98, 0x0}, {0x2919, 0x0}, {0x295C, 0x0}, {0x2061, 0x0}, {0x220C, 0x0}, {0x1D554, 0x0}, {0xDB, 0x0},
+  {0x226B, 0x338}, {0x25EF, 0x0}, {0x1D49F, 0x0}, {0x418, 0x0}, {0x2194, 0x0}, {0x229F, 0x0}, {0x172, 0x0},
+  {0x21CF, 0x0}, {0x23DD, 0x0}, {0x16E, 0x0}, {0x210F, 0x0}, {0x2131, 0x0}, {0x205F, 0x200A}, {0x2134, 0x0},
+  {0x2062, 0x0}, {0x1D4A2, 0x0}, {0x21FE, 0x0}, {0x20DC, 0x0}, {0x2268, 0xFE00}, {0x5B, 0x0}, {0x40B, 0x0},
+  {0x230A, 0x0}, {0xCD, 0x0}, {0xD7, 0x0}, {0x2903, 0x0}, {0x2293, 0x0}, {0x3E, 0x0}, {0x2939, 0x0}, {0x29DD, 0x0},
+  {0x43E, 0x0}, {0x10C, 0x0}, {0x25B1, 0x0}, {0x40E, 0x0}, {0x2305, 0x0}, {0x2255, 0x0}, {0x2155, 0x0}, {0x1D54B, 0x0},
+  {0x2559, 0x0}, {0x437, 0x0}, {0xAF, 0x0}, {0x435, 0x0}, {0x2026, 0x0}, {0x2286, 0x0}, {0x25BD, 0x0}, {0x215B, 0x0},
+  {0x227B, 0x0}, {0x452, 0x0}, {0xA8, 0x0}, {0xF5, 0x0}, {0x2524, 0x0}, {0x223B, 0x0}, {0x225A, 0x0}, {0x2A86, 0x0},
+  {0x406, 0x0}, {0xFD, 0x0}, {0x41B, 0x0}, {0x2336, 0x0}, {0x2AED, 0x0}, {0x2A9D, 0x0}, {0x42A, 0x0}, {0x227B, 0x0},
+  {0x3A8, 0x0}, {0x2A14, 0x0}, {0x226F, 0x0}, {0x2C7, 0x0}, {0x2133, 0x0}, {0xDF, 0x0}, {0x2292, 0x0}, {0x2A97, 0x0},
+  {0x2952, 0x0}, {0x397, 0x0}, {0x22CD, 0x0}, {0x1D4AB, 0x0}, {0x111, 0x0}, {0x21BD, 0x0}, {0x2256, 0x0},
+  {0x1D517, 0x0}, {0x22ED, 0x0}, {0x22CD, 0x0}, {0x2423, 0x0}, {0x227F, 0x0}, {0x2216, 0x0}, {0x440, 0x0},
+  {0x2237, 0x0}, {0x2AC4, 0x0}, {0x166, 0x0}, {0x21CC, 0x0}, {0x22C4, 0x0}, {0xF7, 0x0}, {0x2A3C, 0x0}, {0x29E4, 0x0},
+  {0x170, 0x0}, {0x291F, 0x0}, {0x2933, 0x338}, {0x22D1, 0x0}, {0x2223, 0x0}, {0x21D5, 0x0}, {0x2A5B, 0x0},
+  {0x21BB, 0x0}, {0x1D4BD, 0x0}, {0x2A4D, 0x0}, {0x2588, 0x0}, {0x224E, 0x338}, {0x22B4, 0x0}, {0xC8, 0x0},
+  {0x140, 0x0}, {0x2AB4, 0x0}, {0x44B, 0x0}, {0x2663, 0x0}, {0x255B, 0x0}, {0x2556, 0x0}, {0x210D, 0x0}, {0x200C, 0x0},
+  {0x2953, 0x0}, {0x2225, 0x0}, {0x2229, 0xFE00}, {0x29C9, 0x0}, {0x21D4, 0x0}, {0xA4, 0x0}, {0x13E, 0x0},
+  {0x1D542, 0x0}, {0x2AE9, 0x0}, {0x2962, 0x0}, {0x2220, 0x0}, {0x2964, 0x0}, {0xBE, 0x0}, {0x2214, 0x0}, {0x2A66, 0x0},
+  {0x1D558, 0x0}, {0x2A25, 0x0}, {0x2133, 0x0}, {0x22, 0x0}, {0x200B, 0x0}, {0x2277, 0x0}, {0x2281, 0x0}, {0x29AE, 0x0},
+  {0x2A39, 0x0}, {0x2957, 0x0}, {0x2238, 0x0}, {0x211C, 0x0}, {0x228B, 0x0}, {0x2D8, 0x0}, {0x2016, 0x0},
+  {0x228B, 0xFE00}, {0x2221, 0x0}, {0x25AA, 0x0}, {0x1D54F, 0x0}, {0x2224, 0x0}, {0x2ABF, 0x0}, {0x1D4C6, 0x0},
+  {0xB3, 0x0}, {0x17A, 0x0}, {0x230C, 0x0}, {0x2249, 0x0}, {0x459, 0x0}, {0x226E, 0x0}, {0x2216, 0x0}, {0x2138, 0x0},
+  {0x2277, 0x0}, {0x203E, 0x0}, {0x44C, 0x0}, {0x311, 0x0}, {0x167, 0x0}, {0x297E, 0x0}, {0xF4, 0x0}, {0x1D53C, 0x0},
+  {0x2137, 0x0}, {0x22F3, 0x0}, {0x2105, 0x0}, {0x404, 0x0}, {0x22C7, 0x0}, {0x128, 0x0}, {0x15B, 0x0}, {0x29C5, 0x0},
+  {0x2265, 0x0}, {0x2929, 0x0}, {0x27E8, 0x0}, {0x2A92, 0x0}, {0x1D513, 0x0}, {0x2593, 0x0}, {0x22E1, 0x0},
+  {0x27FC, 0x0}, {0x2A7E, 0x338}, {0x402, 0x0}, {0x215E, 0x0}, {0x23DE, 0x0}, {0x2264, 0x0}, {0x2112, 0x0},
+  {0x2224, 0x0}, {0x2A9A, 0x0}, {0x2AA4, 0x0}, {0xFB01, 0x0}, {0x124, 0x0}, {0x298B, 0x0}, {0x44D, 0x0}, {0x2224, 0x0},
+  {0x22EC, 0x0}, {0xA6, 0x0}, {0x2AD4, 0x0}, {0x156, 0x0}, {0x1D4B3, 0x0}, {0x3D5, 0x0}, {0x22A5, 0x0}, {0x22A7, 0x0},
+  {0x2269, 0xFE00}, {0x2202, 0x0}, {0x227F, 0x338}, {0x2288, 0x0}, {0x230B, 0x0}, {0x2A82, 0x0}, {0x2736, 0x0},
+  {0x21BF, 0x0}, {0x2AA8, 0x0}, {0x152, 0x0}, {0x2555, 0x0}, {0x224C, 0x0}, {0x291E, 0x0}, {0x22F9, 0x338},
+  {0x131, 0x0}, {0x228D, 0x0}, {0x2AD2, 0x0}, {0x2AAC, 0x0}, {0xE8, 0x0}, {0x229A, 0x0}, {0x22C9, 0x0}, {0xD8, 0x0},
+  {0xA9, 0x0}, {0x1D4B4, 0x0}, {0x226B, 0x338}, {0x21A7, 0x0}, {0x229D, 0x0}, {0x201A, 0x0}, {0x2202, 0x0},
+  {0x22C0, 0x0}, {0x3DD, 0x0}, {0x22B6, 0x0}, {0x29F6, 0x0}, {0x22C1, 0x0}, {0x200A, 0x0}, {0x25BE, 0x0}, {0x2959, 0x0},
+  {0x29CE, 0x0}, {0xDC, 0x0}, {0x104, 0x0}, {0x2233, 0x0}, {0x25C2, 0x0}, {0x1D527, 0x0}, {0x2203, 0x0}, {0x2225, 0x0},
+  {0x2309, 0x0}, {0x2ACC, 0x0}, {0x2190, 0x0}, {0x225F, 0x0}, {0x2AB8, 0x0}, {0x2238, 0x0}, {0x22FE, 0x0},
+  {0x2269, 0x0}, {0x2229, 0x0}, {0x154, 0x0}, {0x2ABB, 0x0}, {0x2257, 0x0}, {0x266F, 0x0}, {0x44A, 0x0}, {0x2550, 0x0},
+  {0x22D7, 0x0}, {0xC1, 0x0}, {0x2A23, 0x0}, {0x2933, 0x0}, {0x2248, 0x0}, {0x2A47, 0x0}, {0x2209, 0x0}, {0x2022, 0x0},
+  {0x27E7, 0x0}, {0x2AFD, 0x0}, {0x2293, 0x0}, {0x2294, 0xFE00}, {0x2157, 0x0}, {0x1D532, 0x0}, {0x2115, 0x0},
+  {0x21A3, 0x0}, {0x2112, 0x0}, {0x21AB, 0x0}, {0x200B, 0x0}, {0x21D4, 0x0}, {0x127, 0x0}, {0x2197, 0x0}, {0x227C, 0x0},
+  {0x1D56A, 0x0}, {0x2A36, 0x0}, {0x29A9, 0x0}, {0x228A, 0x0}, {0x2A7D, 0x338}, {0x2663, 0x0}, {0x2A57, 0x0},
+  {0x22CB, 0x0}, {0x2242, 0x0}, {0x219E, 0x0}, {0x2AC6, 0x338}, {0x200B, 0x0}, {0x2AAF, 0x338}, {0x1D564, 0x0},
+  {0xF1, 0x0}, {0x22B4, 0x20D2}, {0x2A7E, 0x338}, {0x2986, 0x0}, {0xB6, 0x0}, {0x2276, 0x0}, {0x2AA2, 0x338},
+  {0x2273, 0x0}, {0x9, 0x0}, {0xC0, 0x0}, {0x3D1, 0x0}, {0x21CB, 0x0}, {0x22C3, 0x0}, {0x297F, 0x0}, {0x21E4, 0x0},
+  {0x412, 0x0}, {0x21C9, 0x0}, {0x21B7, 0x0}, {0x2713, 0x0}, {0x2299, 0x0}, {0x1D512, 0x0}, {0x3E, 0x0}, {0x40C, 0x0},
+  {0x2297, 0x0}, {0x201C, 0x0}, {0x2225, 0x0}, {0xBB, 0x0}, {0x22DA, 0xFE00}, {0x119, 0x0}, {0x144, 0x0}, {0x2205, 0x0},
+  {0x2665, 0x0}, {0x1D505, 0x0}, {0x2A44, 0x0}, {0x2A2F, 0x0}, {0xEE, 0x0}, {0x2205, 0x0}, {0x3C5, 0x0}, {0x22B7, 0x0},
+  {0x212D, 0x0}, {0x2A96, 0x0}, {0x2D8, 0x0}, {0x2290, 0x0}, {0x2926, 0x0}, {0xDD, 0x0}, {0x226E, 0x0}, {0x22BD, 0x0},
+  {0x22, 0x0}, {0x2015, 0x0}, {0x2194, 0x0}, {0x266D, 0x0}, {0x2295, 0x0}, {0x2198, 0x0}, {0x2A26, 0x0}, {0x2AF1, 0x0},
+  {0x126, 0x0}, {0x2A7E, 0x0}, {0x2235, 0x0}, {0x2AC6, 0x338}, {0x22AB, 0x0}, {0x29CF, 0x0}, {0x2124, 0x0},
+  {0x1D525, 0x0}, {0xD4, 0x0}, {0x21CF, 0x0}, {0x25AD, 0x0}, {0x21B3, 0x0}, {0x2551, 0x0}, {0xF0, 0x0}, {0x2502, 0x0},
+  {0x2A88, 0x0}, {0x222D, 0x0}, {0x2148, 0x0}, {0x2A91, 0x0}, {0x2AAE, 0x0}, {0x2248, 0x0}, {0x25B4, 0x0},
+  {0x2A48, 0x0}, {0x2A7D, 0x0}, {0x2257, 0x0}, {0x2A50, 0x0}, {0x2966, 0x0}, {0x2207, 0x0}, {0x25B5, 0x0},
+  {0x22EF, 0x0}, {0x395, 0x0}, {0x2251, 0x0}, {0x25BF, 0x0}, {0xA9, 0x0}, {0x432, 0x0}, {0x22E8, 0x0}, {0x398, 0x0},
+  {0x21B6, 0x0}, {0xCE, 0x0}, {0x2214, 0x0}, {0x2920, 0x0}, {0x3A5, 0x0}, {0xA7, 0x0}, {0xA2, 0x0}, {0x2AB0, 0x338},
+  {0x2267, 0x0}, {0xFF, 0x0}, {0x22CA, 0x0}, {0x22, 0x0}, {0xD7, 0x0}, {0x2289, 0x0}, {0x2562, 0x0}, {0x2773, 0x0},
+  {0x230D, 0x0}, {0x3DD, 0x0}, {0x226C, 0x0}, {0x295E, 0x0}, {0x2277, 0x0}, {0x2190, 0x0}, {0x210A, 0x0}, {0x201C, 0x0},
+  {0x22C2, 0x0}, {0x2250, 0x338}, {0x2234, 0x0}, {0x2147, 0x0}, {0x2199, 0x0}, {0x231C, 0x0}, {0x2ABC, 0x0},
+  {0x25B5, 0x0}, {0x2720, 0x0}, {0x2305, 0x0}, {0x2279, 0x0}, {0xE8, 0x0}, {0x22D1, 0x0}, {0x403, 0x0}, {0x2A4A, 0x0},
+  {0x219A, 0x0}, {0x21C7, 0x0}, {0x2292, 0x0}, {0x22C2, 0x0}, {0x223A, 0x0}, {0x1D510, 0x0}, {0x2208, 0x0},
+  {0x41D, 0x0}, {0x2156, 0x0}, {0xCA, 0x0}, {0x2283, 0x20D2}, {0x2306, 0x0}, {0x7C, 0x0}, {0x2923, 0x0}, {0x2A31, 0x0},
+  {0x2994, 0x0}, {0x2A5D, 0x0}, {0x3A9, 0x0}, {0x2AF2, 0x0}, {0x3C1, 0x0}, {0x2268, 0x0}, {0x22EA, 0x0}, {0xD4, 0x0},
+  {0x3B2, 0x0}, {0x2948, 0x0}, {0x22E2, 0x0}, {0x231C, 0x0}, {0x201E, 0x0}, {0xC7, 0x0}, {0xEC, 0x0}, {0x2A5F, 0x0},
+  {0x2193, 0x0}, {0x21D2, 0x0}, {0x2A99, 0x0}, {0x1D4BF, 0x0}, {0xB7, 0x0}, {0x2232, 0x0}, {0x42E, 0x0}, {0x2191, 0x0},
+  {0x2C7, 0x0}, {0x2A04, 0x0}, {0x2272, 0x0}, {0x2A6D, 0x0}, {0x2AA6, 0x0}, {0x22C4, 0x0}, {0xD1, 0x0}, {0x106, 0x0},
+  {0x21AA, 0x0}, {0x40F, 0x0}, {0x2244, 0x0}, {0xB8, 0x0}, {0x225C, 0x0}, {0x224F, 0x0}, {0x22E9, 0x0}, {0x2128, 0x0},
+  {0x2AC5, 0x0}, {0x2904, 0x0}, {0x215D, 0x0}, {0x22E3, 0x0}, {0x3A9, 0x0}, {0xCC, 0x0}, {0x2298, 0x0}, {0x232D, 0x0},
+  {0x2062, 0x0}, {0x1D520, 0x0}, {0x441, 0x0}, {0x1D535, 0x0}, {0x2272, 0x0}, {0x1D4B9, 0x0}, {0x22D0, 0x0},
+  {0x2225, 0x0}, {0xD0, 0x0}, {0x227E, 0x0}, {0x25AA, 0x0}, {0x2268, 0x0}, {0x22B0, 0x0}, {0x2115, 0x0}, {0x2234, 0x0},
+  {0x2553, 0x0}, {0x299C, 0x0}, {0x2129, 0x0}, {0x21C8, 0x0}, {0x168, 0x0}, {0x2991, 0x0}, {0x227D, 0x0}, {0x27C8, 0x0},
+  {0xF7, 0x0}, {0x425, 0x0}, {0x2772, 0x0}, {0x21CA, 0x0}, {0x291A, 0x0}, {0x29E5, 0x0}, {0x1D4AE, 0x0}, {0x1D55D, 0x0},
+  {0x21D0, 0x0}, {0x21C7, 0x0}, {0x25A1, 0x0}, {0x2AA9, 0x0}, {0x2A30, 0x0}, {0x392, 0x0}, {0x2A3B, 0x0},
+  {0x1D539, 0x0}, {0x201D, 0x0}, {0xA5, 0x0}, {0x2060, 0x0}, {0x210B, 0x0}, {0x29B3, 0x0}, {0x436, 0x0}, {0x227D, 0x0},
+  {0x22D3, 0x0}, {0x266A, 0x0}, {0x2A0C, 0x0}, {0x2250, 0x0}, {0x295A, 0x0}, {0x2009, 0x0}, {0x2973, 0x0},
+  {0x3D, 0x20E5}, {0x2640, 0x0}, {0xC5, 0x0}, {0x22A0, 0x0}, {0x21BE, 0x0}, {0x2283, 0x0}, {0x178, 0x0}, {0xC4, 0x0},
+  {0x3C3, 0x0}, {0x25B9, 0x0}, {0x40, 0x0}, {0x21AD, 0x0}, {0x2A8A, 0x0}, {0x22B3, 0x0}, {0x401, 0x0}, {0x2113, 0x0},
+  {0xD5, 0x0}, {0xB1, 0x0}, {0x2A01, 0x0}, {0x5F, 0x0}, {0x21AA, 0x0}, {0x2A35, 0x0}, {0x224D, 0x0}, {0x291B, 0x0},
+  {0x22C3, 0x0}, {0x2A7E, 0x0}, {0x21BD, 0x0}, {0x21BB, 0x0}, {0x2322, 0x0}, {0x1D53B, 0x0}, {0x203A, 0x0},
+  {0x22A1, 0x0}, {0x22D8, 0x0}, {0x1D4BE, 0x0}, {0xD9, 0x0}, {0xD3, 0x0}, {0x23B1, 0x0}, {0x2924, 0x0}, {0x2A02, 0x0},
+  {0x2A80, 0x0}, {0x2248, 0x0}, {0xA1, 0x0}, {0x2131, 0x0}, {0xD1, 0x0}, {0x2198, 0x0}, {0x3F1, 0x0}, {0x21E5, 0x0},
+  {0x2560, 0x0}, {0x2213, 0x0}, {0x227B, 0x0}, {0x1D516, 0x0}, {0x2272, 0x0}, {0x393, 0x0}, {0x27E6, 0x0},
+  {0x1D538, 0x0}, {0x2A3A, 0x0}, {0x2292, 0x0}, {0x2975, 0x0}, {0x1D4B7, 0x0}, {0x2013, 0x0}, {0x2228, 0x0},
+  {0x224E, 0x0}, {0x2208, 0x0}, {0x2D9, 0x0}, {0x2960, 0x0}, {0x296F, 0x0}, {0x2282, 0x0}, {0x222A, 0xFE00},
+  {0x21CC, 0x0}, {0xF9, 0x0}, {0x224C, 0x0}, {0x2310, 0x0}, {0x2254, 0x0}, {0xCB, 0x0}, {0x296B, 0x0}, {0x2254, 0x0},
+  {0x200E, 0x0}, {0x229A, 0x0}, {0x2283, 0x0}, {0x223C, 0x0}, {0x1D565, 0x0}, {0x2A6A, 0x0}, {0x21A2, 0x0},
+  {0x220C, 0x0}, {0x210B, 0x0}, {0x2720, 0x0}, {0x429, 0x0}, {0x22AD, 0x0}, {0x66, 0x6A}, {0x2032, 0x0}, {0x290D, 0x0},
+  {0x117, 0x0}, {0x21CD, 0x0}, {0xEF, 0x0}, {0x22C7, 0x0}, {0x2A5C, 0x0}, {0x43B, 0x0}, {0x2256, 0x0}, {0x2207, 0x0},
+  {0xE2, 0x0}, {0x25F8, 0x0}, {0x2A22, 0x0}, {0x23DF, 0x0}, {0x3C4, 0x0}, {0x29B7, 0x0}, {0x22F2, 0x0}, {0xA9, 0x0},
+  {0x21C0, 0x0}, {0x2242, 0x338}, {0x2271, 0x0}, {0x290D, 0x0}, {0x2A00, 0x0}, {0x2591, 0x0}, {0x221D, 0x0},
+  {0x2274, 0x0}, {0xDE, 0x0}, {0x22A3, 0x0}, {0x1D4B0, 0x0}, {0x1D4B5, 0x0}, {0xA0, 0x0}, {0x220B, 0x0}, {0x2216, 0x0},
+  {0x2209, 0x0}, {0x219B, 0x0}, {0x2AEE, 0x0}, {0x1D4AC, 0x0}, {0x2500, 0x0}, {0x22BB, 0x0}, {0x2226, 0x0},
+  {0x2AB5, 0x0}, {0x292A, 0x0}, {0x2241, 0x0}, {0x1D53D, 0x0}, {0x22C8, 0x0}, {0x21FF, 0x0}, {0x2286, 0x0},
+  {0x2014, 0x0}, {0x2122, 0x0}, {0x3C6, 0x0}, {0x2ACC, 0xFE00}, {0x22AC, 0x0}, {0x2E, 0x0}, {0x29E3, 0x0},
+  {0x2979, 0x0}, {0x293C, 0x0}, {0x22FD, 0x0}, {0x3C, 0x0}, {0x224E, 0x0}, {0x2266, 0x0}, {0x2233, 0x0}, {0xC5, 0x0},
+  {0x222B, 0x0}, {0x2B, 0x0}, {0x22D7, 0x0}, {0x3A7, 0x0}, {0x3E, 0x20D2}, {0x2A93, 0x0}, {0x224A, 0x0}, {0x210F, 0x0},
+  {0xAB, 0x0}, {0x2267, 0x338}, {0x22B5, 0x0}, {0x1D55A, 0x0}, {0xC8, 0x0}, {0x1D51C, 0x0}, {0x424, 0x0}, {0xA2, 0x0},
+  {0x1D533, 0x0}, {0x26, 0x0}, {0x161, 0x0}, {0x211A, 0x0}, {0x25C2, 0x0}, {0xCF, 0x0}, {0x2196, 0x0}, {0x2A06, 0x0},
+  {0x5D, 0x0}, {0x21AC, 0x0}, {0x3B7, 0x0}, {0xCA, 0x0}, {0x2A8A, 0x0}, {0x2308, 0x0}, {0x22B2, 0x0}, {0x22CF, 0x0},
+  {0x2666, 0x0}, {0x2955, 0x0}, {0x41C, 0x0}, {0xDA, 0x0}, {0x2236, 0x0}, {0x2DD, 0x0}, {0x2198, 0x0}, {0x2928, 0x0},
+  {0x21BA, 0x0}, {0x228A, 0xFE00}, {0x2235, 0x0}, {0x22E2, 0x0}, {0xBF, 0x0}, {0x2275, 0x0}, {0xC6, 0x0}, {0x21CE, 0x0},
+  {0x260E, 0x0}, {0xD8, 0x0}, {0x225C, 0x0}, {0x237C, 0x0}, {0x211D, 0x0}, {0x3E, 0x0}, {0x2299, 0x0}, {0x2116, 0x0},
+  {0x2567, 0x0}, {0x22C1, 0x0}, {0xC7, 0x0}, {0x24C8, 0x0}, {0x2580, 0x0}, {0x290C, 0x0}, {0x109, 0x0}, {0x3A4, 0x0},
+  {0x21D3, 0x0}, {0x15E, 0x0}, {0x2008, 0x0}, {0x2945, 0x0}, {0x22BA, 0x0}, {0x227C, 0x0}, {0x27C9, 0x0}, {0x29CD, 0x0},
+  {0x12F, 0x0}, {0xC5, 0x0}, {0x11E, 0x0}, {0x231F, 0x0}, {0x2021, 0x0}, {0x27E6, 0x0}, {0x2253, 0x0}, {0x25BE, 0x0},
+  {0xAE, 0x0}, {0x3BC, 0x0}, {0x419, 0x0}, {0x221A, 0x0}, {0x20DB, 0x0}, {0x2938, 0x0}, {0x147, 0x0}, {0x222D, 0x0},
+  {0x2A70, 0x0}, {0xB1, 0x0}, {0x29DE, 0x0}, {0xE1, 0x0}, {0x226F, 0x0}, {0xFE, 0x0}, {0x204F, 0x0}, {0xE3, 0x0},
+  {0x2259, 0x0}, {0x2AB0, 0x0}, {0x136, 0x0}, {0x27FA, 0x0}, {0x2AC3, 0x0}, {0x25B3, 0x0}, {0x266E, 0x0}, {0x2564, 0x0},
+  {0x2118, 0x0}, {0x22CE, 0x0}, {0x1F5, 0x0}, {0x2119, 0x0}, {0x2110, 0x0}, {0x2291, 0x0}, {0x220B, 0x0}, {0xA3, 0x0},
+  {0x2965, 0x0}, {0x2003, 0x0}, {0x21D0, 0x0}, {0xE6, 0x0}, {0x129, 0x0}, {0x2985, 0x0}, {0x121, 0x0}, {0x2ACB, 0xFE00},
+  {0x2AAF, 0x338}, {0x22A9, 0x0}, {0x2044, 0x0}, {0x2243, 0x0}, {0x2ABD, 0x0}, {0x1D4CE, 0x0}, {0x27F8, 0x0},
+  {0x2AB7, 0x0}, {0x2268, 0xFE00}, {0x212C, 0x0}, {0x237, 0x0}, {0xB7, 0x0}, {0x228B, 0xFE00}, {0x2954, 0x0},
+  {0x3DC, 0x0}, {0xEA, 0x0}, {0x2204, 0x0}, {0x226B, 0x20D2}, {0x1D4CC, 0x0}, {0xFB02, 0x0}, {0x29D0, 0x0},
+  {0x219A, 0x0}, {0x16C, 0x0}, {0x3C, 0x20D2}, {0x27F5, 0x0}, {0x21C8, 0x0}, {0x2145, 0x0}, {0x3BF, 0x0}, {0x2AD5, 0x0},
+  {0x2665, 0x0}, {0x2ACB, 0xFE00}, {0x454, 0x0}, {0x21D1, 0x0}, {0x224D, 0x0}, {0x1D4CD, 0x0}, {0x2260, 0x0},
+  {0x2190, 0x0}, {0x211C, 0x0}, {0x228E, 0x0}, {0x2199, 0x0}, {0x5D, 0x0}, {0x23DC, 0x0}, {0x2203, 0x0}, {0x2AA5, 0x0},
+  {0x2606, 0x0}, {0x27E9, 0x0}, {0x135, 0x0}, {0x1D521, 0x0}, {0x2AAD, 0x0}, {0x2280, 0x0}, {0x22AE, 0x0},
+  {0x2A7D, 0x338}, {0x2A0D, 0x0}, {0x22A4, 0x0}, {0x42F, 0x0}, {0x1D4C7, 0x0}, {0x2297, 0x0}, {0x290E, 0x0},
+  {0x2245, 0x0}, {0xD3, 0x0}, {0x3B9, 0x0}, {0x2270, 0x0}, {0x2026, 0x0}, {0x2A7C, 0x0}, {0x422, 0x0}, {0x22F4, 0x0},
+  {0x2A40, 0x0}, {0x22EC, 0x0}, {0x22DA, 0x0}, {0x227F, 0x0}, {0x266E, 0x0}, {0x227A, 0x0}, {0x231D, 0x0},
+  {0x2264, 0x20D2}, {0x294F, 0x0}, {0x22A0, 0x0}, {0x21D1, 0x0}, {0x3F, 0x0}, {0x100, 0x0}, {0x228F, 0x338},
+  {0xF9, 0x0}, {0x1D55F, 0x0}, {0x1D562, 0x0}, {0x2204, 0x0}, {0x29AF, 0x0}, {0x2A90, 0x0}, {0x1D4B1, 0x0},
+  {0x22A5, 0x0}, {0x2225, 0x0}, {0x2111, 0x0}, {0x1D546, 0x0}, {0x29EB, 0x0}, {0x2566, 0x0}, {0xC3, 0x0}, {0x2192, 0x0},
+  {0x26, 0x0}, {0x2660, 0x0}, {0x22CC, 0x0}, {0xED, 0x0}, {0x21C1, 0x0}, {0x2135, 0x0}, {0xE3, 0x0}, {0x28, 0x0},
+  {0x138, 0x0}, {0x2118, 0x0}, {0x2273, 0x0}, {0xA7, 0x0}, {0x2AAF, 0x0}, {0x295F, 0x0}, {0x2666, 0x0}, {0xFB03, 0x0},
+  {0x2AAF, 0x338}, {0x2A72, 0x0}, {0x29AD, 0x0}, {0xF3, 0x0}, {0x21D2, 0x0}, {0x2AC2, 0x0}, {0xD9, 0x0}, {0x2AA2, 0x0},
+  {0x2AF3, 0x0}, {0x221A, 0x0}, {0x22E0, 0x0}, {0x2266, 0x338}, {0x22F6, 0x0}, {0xBD, 0x0}, {0x2322, 0x0}, {0x29, 0x0},
+  {0x2283, 0x20D2}, {0x1D54A, 0x0}, {0x1D528, 0x0}, {0x2AB0, 0x338}, {0x2AAD, 0xFE00}, {0x1D509, 0x0}, {0x139, 0x0},
+  {0x2A8D, 0x0}, {0x105, 0x0}, {0x22B9, 0x0}, {0x2226, 0x0}, {0x2247, 0x0}, {0x2323, 0x0}, {0x145, 0x0}, {0x21BE, 0x0},
+  {0x2119, 0x0}, {0x21D7, 0x0}, {0x203E, 0x0}, {0x2276, 0x0}, {0x21BF, 0x0}, {0x2AFD, 0x20E5}, {0x458, 0x0},
+  {0x1D54D, 0x0}, {0xA5, 0x0}, {0x2AC0, 0x0}, {0xB5, 0x0}, {0x2995, 0x0}, {0x2916, 0x0}, {0x2A2A, 0x0}, {0x2905, 0x0},
+  {0x2A27, 0x0}, {0x2243, 0x0}, {0x2510, 0x0}, {0x1D569, 0x0}, {0x1D4A9, 0x0}, {0x3C, 0x0}, {0x21A5, 0x0},
+  {0x2605, 0x0}, {0x2971, 0x0}, {0x25CA, 0x0}, {0x2A3F, 0x0}, {0x2A7A, 0x0}, {0xFD, 0x0}, {0x21A0, 0x0}, {0x2A8B, 0x0},
+  {0xFA, 0x0}, {0x3C5, 0x0}, {0x2279, 0x0}, {0x21DD, 0x0}, {0x22D4, 0x0}, {0x444, 0x0}, {0xB8, 0x0}, {0x1D4C3, 0x0},
+  {0x42D, 0x0}, {0x226B, 0x0}, {0x2ABA, 0x0}, {0xEB, 0x0}, {0x2271, 0x0}, {0x3D1, 0x0}, {0x220B, 0x0}, {0x255D, 0x0},
+  {0xBE, 0x0}, {0x21A6, 0x0}, {0x2280, 0x0}, {0x22F7, 0x0}, {0x21A1, 0x0}, {0x27F7, 0x0}, {0xCD, 0x0}, {0x2902, 0x0},
+  {0xC2, 0x0}, {0x173, 0x0}, {0x222E, 0x0}, {0x39D, 0x0}, {0x2A7E, 0x0}, {0x1D566, 0x0}, {0x2A78, 0x0}, {0xB8, 0x0},
+  {0x1D51B, 0x0}, {0x2AC5, 0x0}, {0x2280, 0x0}, {0xBA, 0x0}, {0x200B, 0x0}, {0x44F, 0x0}, {0xA3, 0x0}, {0x2ACB, 0x0},
+  {0x2192, 0x0}, {0x141, 0x0}, {0xC4, 0x0}, {0x2935, 0x0}, {0x2925, 0x0}, {0x110, 0x0}, {0x2146, 0x0}, {0x2235, 0x0},
+  {0x1D550, 0x0}, {0x2A89, 0x0}, {0x221D, 0x0}, {0x22A1, 0x0}, {0x200B, 0x0}, {0x215C, 0x0}, {0x2A81, 0x0},
+  {0x112, 0x0}, {0x253C, 0x0}, {0x21E4, 0x0}, {0x2267, 0x338}, {0x2124, 0x0}, {0x2248, 0x0}, {0x2196, 0x0},
+  {0x17E, 0x0}, {0x21C0, 0x0}, {0x2AD8, 0x0}, {0x219F, 0x0}, {0x415, 0x0}, {0xFB00, 0x0}, {0x45C, 0x0}, {0x21A6, 0x0},
+  {0x22DB, 0x0}, {0x132, 0x0}, {0x2216, 0x0}, {0x1D52D, 0x0}, {0x223D, 0x0}, {0x2193, 0x0}, {0x133, 0x0}, {0x2AB8, 0x0},
+  {0x11C, 0x0}, {0x130, 0x0}, {0x24, 0x0}, {0x2270, 0x0}, {0x29B6, 0x0}, {0xDF, 0x0}, {0x41E, 0x0}, {0x21D4, 0x0},
+  {0x391, 0x0}, {0x2A70, 0x338}, {0x1D50A, 0x0}, {0x2518, 0x0}, {0x15A, 0x0}, {0x2283, 0x0}, {0x2281, 0x0},
+  {0x3A3, 0x0}, {0x2A6D, 0x338}, {0xAD, 0x0}, {0x45E, 0x0}, {0x14D, 0x0}, {0x229F, 0x0}, {0x2261, 0x0}, {0x230B, 0x0},
+  {0xE0, 0x0}, {0xF2, 0x0}, {0x2217, 0x0}, {0x226B, 0x0}, {0x1D536, 0x0}, {0x25A1, 0x0}, {0x226A, 0x0}, {0x2261, 0x0},
+  {0x2A3C, 0x0}, {0x2AEF, 0x0}, {0x2642, 0x0}, {0x2282, 0x20D2}, {0x1D52A, 0x0}, {0x3D6, 0x0}, {0x211D, 0x0},
+  {0x1D567, 0x0}, {0x211B, 0x0}, {0xB0, 0x0}, {0x227F, 0x0}, {0x2043, 0x0}, {0x1D49E, 0x0}, {0x1D511, 0x0},
+  {0x29BE, 0x0}, {0x29C4, 0x0}, {0x223E, 0x0}, {0x21D1, 0x0}, {0x3D2, 0x0}, {0x1D560, 0x0}, {0x3F5, 0x0},
+  {0x224F, 0x338}, {0x27F7, 0x0}, {0x455, 0x0}, {0x12E, 0x0}, {0x14A, 0x0}, {0x5B, 0x0}, {0xF6, 0x0}, {0x16F, 0x0},
+  {0x1D4CA, 0x0}, {0x2A45, 0x0}, {0x438, 0x0}, {0x2287, 0x0}, {0x2286, 0x0}, {0x2A7E, 0x338}, {0xA0, 0x0}, {0x3BD, 0x0},
+  {0x296A, 0x0}, {0x2A4B, 0x0}, {0x21C2, 0x0}, {0x2AB5, 0x0}, {0x1D504, 0x0}, {0x210C, 0x0}, {0x116, 0x0},
+  {0x2241, 0x0}, {0x21D6, 0x0}, {0x229E, 0x0}, {0x2592, 0x0}, {0x2996, 0x0}, {0x2266, 0x0}, {0x16D, 0x0}, {0x25B8, 0x0},
+  {0x226A, 0x0}, {0x226B, 0x0}, {0x224A, 0x0}, {0x22A2, 0x0}, {0x251C, 0x0}, {0x2213, 0x0}, {0x2231, 0x0},
+  {0x2018, 0x0}, {0x10F, 0x0}, {0x298D, 0x0}, {0x29DC, 0x0}, {0x27F8, 0x0}, {0x13B, 0x0}, {0x430, 0x0}, {0x22D9, 0x338},
+  {0xB3, 0x0}, {0x228A, 0xFE00}, {0x291C, 0x0}, {0x22DA, 0x0}, {0x409, 0x0}, {0x25A1, 0x0}, {0x2290, 0x0},
+  {0x2A15, 0x0}, {0xE7, 0x0}, {0x2AB9, 0x0}, {0x2A46, 0x0}, {0x2660, 0x0}, {0xC1, 0x0}, {0x103, 0x0}, {0x3BA, 0x0},
+  {0xC9, 0x0}, {0x222E, 0x0}, {0x232E, 0x0}, {0x192, 0x0}, {0x2110, 0x0}, {0x2A, 0x0}, {0x5E, 0x0}, {0x27FA, 0x0},
+  {0x2293, 0xFE00}, {0x2ACF, 0x0}, {0x27F5, 0x0}, {0xB6, 0x0}, {0x23, 0x0}, {0x2250, 0x0}, {0x1D4CF, 0x0}, {0x43D, 0x0},
+  {0x2A2D, 0x0}, {0x174, 0x0}, {0x3C, 0x0}, {0x3E, 0x0}, {0x21BC, 0x0}, {0x2A8F, 0x0}, {0x2210, 0x0}, {0x2020, 0x0},
+  {0x221E, 0x0}, {0x22C6, 0x0}, {0x231E, 0x0}, {0x2288, 0x0}, {0xEA, 0x0}, {0xBB, 0x0}, {0x2AB3, 0x0}, {0x3D6, 0x0},
+  {0x1D4B8, 0x0}, {0x22F1, 0x0}, {0x27F5, 0x0}, {0x212F, 0x0}, {0x27FC, 0x0}, {0x25B9, 0x0}, {0x21A9, 0x0},
+  {0x222B, 0x0}, {0x1D552, 0x0}, {0x22D0, 0x0}, {0xB0, 0x0}, {0x2147, 0x0}, {0x1D534, 0x0}, {0x227E, 0x0},
+  {0x290F, 0x0}, {0x3BB, 0x0}, {0x2A7D, 0x0}, {0x2296, 0x0}, {0x120, 0x0}, {0x25CB, 0x0}, {0x22F5, 0x0}, {0x2A8E, 0x0},
+  {0x148, 0x0}, {0x29A6, 0x0}, {0x2159, 0x0}, {0x42B, 0x0}, {0x2248, 0x0}, {0x2209, 0x0}, {0x21FD, 0x0}, {0x1D541, 0x0},
+  {0x3C, 0x0}, {0x2AB0, 0x0}, {0x2242, 0x0}, {0xAC, 0x0}, {0x224B, 0x338}, {0x2AA0, 0x0}, {0x29C1, 0x0},
+  {0x29CF, 0x338}, {0x2563, 0x0}, {0x108, 0x0}, {0x224E, 0x338}, {0x25FB, 0x0}, {0x2208, 0x0}, {0x296E, 0x0},
+  {0x2A34, 0x0}, {0x2034, 0x0}, {0x22C4, 0x0}, {0x228B, 0x0}, {0x26, 0x0},
+};
+
+#endif // NTK_HTML_ENTITIES_H
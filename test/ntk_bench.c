@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ntk.h"
+#include "test_articles.h"
+
+// Compares the fused sanitize-and-escape functions against sanitizing with ntk_sanitize_utf8 and then escaping the
+// sanitized copy. Not run by ctest; build the ntk_bench target and run it directly.
+
+enum
+{
+  copies = 1024,       // About 37 MiB of input
+  corruptEvery = 4096, // One invalid byte per this many
+};
+
+static double seconds_since(clock_t start)
+{
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void report(const char* pName, size_t len, double twoStep, double fused)
+{
+  const double mib = (double)len / (1024.0 * 1024.0);
+  printf("%-16s two-step %8.1f MiB/s   fused %8.1f MiB/s   %.2fx\n", pName, mib / twoStep, mib / fused,
+         twoStep / fused);
+}
+
+static void bench_format(const char* pName, const char* pStr, size_t len, enum ntk_escape_format format)
+{
+  size_t outLen;
+  clock_t start = clock();
+  size_t sanitizedLen;
+  char* pSanitized = ntk_sanitize_utf8(pStr, len, &sanitizedLen);
+  char* pOut = NULL;
+
+  switch (format)
+  {
+    case ntk_escape_format_html:
+      pOut = ntk_escape_html_alloc(pSanitized, sanitizedLen, &outLen);
+      break;
+    case ntk_escape_format_html_attribute:
+      pOut = ntk_escape_html_attribute_alloc(pSanitized, sanitizedLen, ntk_html_attribute_double_quoted, &outLen);
+      break;
+    case ntk_escape_format_json:
+      pOut = malloc(ntk_escape_json_length(pSanitized, sanitizedLen, 0));
+      ntk_escape_json(pSanitized, sanitizedLen, 0, pOut, &outLen);
+      break;
+    case ntk_escape_format_js:
+      pOut = malloc(ntk_escape_js_length(pSanitized, sanitizedLen));
+      ntk_escape_js(pSanitized, sanitizedLen, pOut, &outLen);
+      break;
+    case ntk_escape_format_xml:
+      pOut = malloc(ntk_escape_xml_length(pSanitized, sanitizedLen, 0));
+      ntk_escape_xml(pSanitized, sanitizedLen, 0, pOut, &outLen);
+      break;
+    case ntk_escape_format_html_attribute_single_quoted:
+      pOut = ntk_escape_html_attribute_alloc(pSanitized, sanitizedLen, ntk_html_attribute_single_quoted, &outLen);
+      break;
+    case ntk_escape_format_html_attribute_unquoted:
+      pOut = ntk_escape_html_attribute_alloc(pSanitized, sanitizedLen, ntk_html_attribute_unquoted, &outLen);
+      break;
+  }
+
+  double twoStep = seconds_since(start);
+  free(pOut);
+  free(pSanitized);
+
+  start = clock();
+  pOut = ntk_escape_sanitized_alloc(pStr, len, format, &outLen);
+  double fused = seconds_since(start);
+  free(pOut);
+
+  report(pName, len, twoStep, fused);
+}
+
+static void bench_url(const char* pStr, size_t len)
+{
+  size_t outLen;
+  clock_t start = clock();
+  size_t sanitizedLen;
+  char* pSanitized = ntk_sanitize_utf8(pStr, len, &sanitizedLen);
+  char* pOut = malloc(ntk_escape_url_length(pSanitized, sanitizedLen, ntk_url_query));
+  ntk_escape_url(pSanitized, sanitizedLen, ntk_url_query, pOut, &outLen);
+  double twoStep = seconds_since(start);
+  free(pOut);
+  free(pSanitized);
+
+  start = clock();
+  pOut = ntk_escape_url_sanitized_alloc(pStr, len, ntk_url_query, &outLen);
+  double fused = seconds_since(start);
+  free(pOut);
+
+  report("url query", len, twoStep, fused);
+}
+
+int main(void)
+{
+  const size_t len = (size_t)copies * uni_hannover_html_len;
+  char* pStr = malloc(len);
+
+  if (pStr == NULL)
+  {
+    return 1;
+  }
+
+  for (size_t i = 0; i < copies; ++i)
+  {
+    memcpy(pStr + i * uni_hannover_html_len, uni_hannover_html, uni_hannover_html_len);
+  }
+
+  for (size_t i = corruptEvery; i < len; i += corruptEvery)
+  {
+    pStr[i] = (char)0xFF;
+  }
+
+  // Warm up the allocator and page tables, so the first measurement is not penalized
+  size_t warmLen;
+  free(ntk_sanitize_utf8(pStr, len, &warmLen));
+
+  bench_format("html", pStr, len, ntk_escape_format_html);
+  bench_format("html attribute", pStr, len, ntk_escape_format_html_attribute);
+  bench_format("json", pStr, len, ntk_escape_format_json);
+  bench_format("js", pStr, len, ntk_escape_format_js);
+  bench_format("xml", pStr, len, ntk_escape_format_xml);
+  bench_format("html attr single", pStr, len, ntk_escape_format_html_attribute_single_quoted);
+  bench_format("html attr bare", pStr, len, ntk_escape_format_html_attribute_unquoted);
+  bench_url(pStr, len);
+
+  free(pStr);
+  return 0;
+}
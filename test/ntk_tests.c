@@ -146,6 +146,12 @@ void test_BrokenContinuation(void)
 
   const char* pInterrupt4C = "\xF2\x82\x82 ";
   TEST_ASSERT_FALSE(ntk_is_utf8(pInterrupt4C, 4));
+
+  // Lead bytes with a restricted second byte still require it to be a continuation byte
+  TEST_ASSERT_FALSE(ntk_is_utf8("\xE0\xE0\x80", 3));
+  TEST_ASSERT_FALSE(ntk_is_utf8("\xED\x20\x80", 3));
+  TEST_ASSERT_FALSE(ntk_is_utf8("\xF0\xF0\x80\x80", 4));
+  TEST_ASSERT_FALSE(ntk_is_utf8("\xF4\x20\x80\x80", 4));
 }
 
 void test_OverlongSequences(void)
@@ -280,6 +286,1490 @@ void test_SanitizeFuzz(void)
   }
 }
 
+void test_Latin1ToUtf8(void)
+{
+  const char* pIn = "Caf\xE9 na\xEFve r\xE9sum\xE9 \x80\xFF and a longer ASCII tail";
+  size_t inLen = strlen(pIn);
+  const char* pExp = "Caf\xC3\xA9 na\xC3\xAFve r\xC3\xA9sum\xC3\xA9 \xC2\x80\xC3\xBF and a longer ASCII tail";
+  size_t expLen = strlen(pExp);
+
+  TEST_ASSERT_EQUAL_size_t(expLen, ntk_utf8_length_from_latin1(pIn, inLen));
+
+  char out[128];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_latin1_to_utf8(pIn, inLen, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, expLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  TEST_ASSERT_FALSE(ntk_latin1_to_utf8(NULL, 0, out, &outLen));
+}
+
+void test_Latin1AllBytesRoundTrip(void)
+{
+  char latin1[256];
+  for (int i = 0; i < 256; ++i)
+  {
+    latin1[i] = (char)i;
+  }
+
+  char utf8[512];
+  size_t utf8Len;
+  TEST_ASSERT_TRUE(ntk_latin1_to_utf8(latin1, sizeof(latin1), utf8, &utf8Len));
+  TEST_ASSERT_EQUAL_size_t(384, utf8Len);
+  TEST_ASSERT_TRUE(ntk_is_utf8(utf8, utf8Len));
+
+  TEST_ASSERT_EQUAL_size_t(sizeof(latin1), ntk_latin1_length_from_utf8(utf8, utf8Len));
+
+  char back[256];
+  size_t backLen;
+  TEST_ASSERT_TRUE(ntk_utf8_to_latin1(utf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(latin1), backLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(latin1, back, sizeof(latin1));
+}
+
+void test_Utf8ToLatin1Failures(void)
+{
+  char out[16];
+  size_t outLen;
+
+  // U+0100 is the first code point outside Latin-1
+  const char* pOutOfRange = "abc\xC4\x80";
+  TEST_ASSERT_FALSE(ntk_utf8_to_latin1(pOutOfRange, strlen(pOutOfRange), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+
+  const char* pEuro = "\xE2\x82\xAC";
+  TEST_ASSERT_FALSE(ntk_utf8_to_latin1(pEuro, strlen(pEuro), out, &outLen));
+
+  const char* pTruncated = "abc\xC3";
+  TEST_ASSERT_FALSE(ntk_utf8_to_latin1(pTruncated, strlen(pTruncated), out, &outLen));
+
+  const char* pBadContinuation = "\xC3 ";
+  TEST_ASSERT_FALSE(ntk_utf8_to_latin1(pBadContinuation, strlen(pBadContinuation), out, &outLen));
+
+  const char* pOverlong = "\xC1\xBF";
+  TEST_ASSERT_FALSE(ntk_utf8_to_latin1(pOverlong, strlen(pOverlong), out, &outLen));
+
+  const char* pStray = "\xA9";
+  TEST_ASSERT_FALSE(ntk_utf8_to_latin1(pStray, strlen(pStray), out, &outLen));
+}
+
+void test_LengthsAsciiAndMixed(void)
+{
+  // "ntk: \u00E9 \u20AC \U0001F600" followed by enough ASCII to exercise the word-at-a-time paths
+  const char* pUtf8 = "ntk: \xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 the quick brown fox";
+  size_t utf8Len = strlen(pUtf8);
+  const uint16_t utf16[] = {'n', 't', 'k', ':', ' ', 0x00E9, ' ', 0x20AC, ' ', 0xD83D, 0xDE00, ' ', 't', 'h', 'e', ' ',
+                            'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x'};
+  size_t utf16Len = sizeof(utf16) / sizeof(utf16[0]);
+  const uint32_t utf32[] = {'n', 't', 'k', ':', ' ', 0x00E9, ' ', 0x20AC, ' ', 0x1F600, ' ', 't', 'h', 'e', ' ',
+                            'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x'};
+  size_t utf32Len = sizeof(utf32) / sizeof(utf32[0]);
+
+  TEST_ASSERT_EQUAL_size_t(utf16Len, ntk_utf16_length_from_utf8(pUtf8, utf8Len));
+  TEST_ASSERT_EQUAL_size_t(utf32Len, ntk_utf32_length_from_utf8(pUtf8, utf8Len));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, ntk_utf8_length_from_utf16(utf16, utf16Len));
+  TEST_ASSERT_EQUAL_size_t(utf32Len, ntk_utf32_length_from_utf16(utf16, utf16Len));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, ntk_utf8_length_from_utf32(utf32, utf32Len));
+  TEST_ASSERT_EQUAL_size_t(utf16Len, ntk_utf16_length_from_utf32(utf32, utf32Len));
+
+  TEST_ASSERT_EQUAL_size_t(0, ntk_utf16_length_from_utf8(NULL, 4));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_utf8_length_from_utf16(NULL, 4));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_utf8_length_from_utf32(NULL, 4));
+}
+
+void test_LengthsBoundaries(void)
+{
+  const uint32_t utf32[] = {0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF};
+  size_t utf32Len = sizeof(utf32) / sizeof(utf32[0]);
+  TEST_ASSERT_EQUAL_size_t(1 + 2 + 2 + 3 + 3 + 3 + 3 + 4 + 4, ntk_utf8_length_from_utf32(utf32, utf32Len));
+  TEST_ASSERT_EQUAL_size_t(utf32Len + 2, ntk_utf16_length_from_utf32(utf32, utf32Len));
+
+  const uint16_t utf16[] = {0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF, 0xD800, 0xDC00, 0xDBFF, 0xDFFF};
+  size_t utf16Len = sizeof(utf16) / sizeof(utf16[0]);
+  TEST_ASSERT_EQUAL_size_t(1 + 2 + 2 + 3 + 3 + 3 + 3 + 4 + 4, ntk_utf8_length_from_utf16(utf16, utf16Len));
+  TEST_ASSERT_EQUAL_size_t(utf32Len, ntk_utf32_length_from_utf16(utf16, utf16Len));
+
+  const char* pUtf8 = "\x7F\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBF\xF0\x90\x80\x80"
+                      "\xF4\x8F\xBF\xBF";
+  size_t utf8Len = strlen(pUtf8);
+  TEST_ASSERT_EQUAL_size_t(utf16Len, ntk_utf16_length_from_utf8(pUtf8, utf8Len));
+  TEST_ASSERT_EQUAL_size_t(utf32Len, ntk_utf32_length_from_utf8(pUtf8, utf8Len));
+}
+
+void test_CharsetWindows1252(void)
+{
+  // Smart quotes, euro sign and an em dash, which Windows-1252 places in the ISO-8859-1 C1 range
+  const char* pIn = "\x93Quoted\x94 costs \x80" "5 \x97 caf\xE9";
+  size_t inLen = strlen(pIn);
+  const char* pExp = "\xE2\x80\x9CQuoted\xE2\x80\x9D costs \xE2\x82\xAC" "5 \xE2\x80\x94 caf\xC3\xA9";
+  size_t expLen = strlen(pExp);
+
+  TEST_ASSERT_EQUAL_size_t(expLen, ntk_utf8_length_from_charset(pIn, inLen, ntk_charset_windows_1252));
+
+  char out[64];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_charset_to_utf8(pIn, inLen, ntk_charset_windows_1252, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, expLen);
+
+  // 0x81 is unassigned in Windows-1252
+  const char* pUnassigned = "a\x81z";
+  const char* pReplaced = "a\xEF\xBF\xBDz";
+  TEST_ASSERT_EQUAL_size_t(strlen(pReplaced), ntk_utf8_length_from_charset(pUnassigned, 3, ntk_charset_windows_1252));
+  TEST_ASSERT_TRUE(ntk_charset_to_utf8(pUnassigned, 3, ntk_charset_windows_1252, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pReplaced), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pReplaced, out, outLen);
+}
+
+void test_CharsetOthers(void)
+{
+  char out[64];
+  size_t outLen;
+
+  // "Привет" in KOI8-R
+  const char* pKoi8 = "\xF0\xD2\xC9\xD7\xC5\xD4";
+  const char* pKoi8Exp = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82";
+  TEST_ASSERT_TRUE(ntk_charset_to_utf8(pKoi8, strlen(pKoi8), ntk_charset_koi8_r, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pKoi8Exp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pKoi8Exp, out, outLen);
+
+  // Euro sign moved to 0xA4 in ISO-8859-15
+  const char* pIso15 = "\xA4";
+  TEST_ASSERT_TRUE(ntk_charset_to_utf8(pIso15, 1, ntk_charset_iso_8859_15, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(3, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("\xE2\x82\xAC", out, outLen);
+
+  // ISO-8859-1 through the table matches the dedicated converter
+  char latin1[256];
+  for (int i = 0; i < 256; ++i)
+  {
+    latin1[i] = (char)i;
+  }
+  char viaTable[512];
+  char viaLatin1[512];
+  size_t viaLatin1Len;
+  TEST_ASSERT_TRUE(ntk_charset_to_utf8(latin1, sizeof(latin1), ntk_charset_iso_8859_1, viaTable, &outLen));
+  TEST_ASSERT_TRUE(ntk_latin1_to_utf8(latin1, sizeof(latin1), viaLatin1, &viaLatin1Len));
+  TEST_ASSERT_EQUAL_size_t(viaLatin1Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(viaLatin1, viaTable, outLen);
+
+  TEST_ASSERT_FALSE(ntk_charset_to_utf8(pIso15, 1, (enum ntk_charset)1000, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_utf8_length_from_charset(pIso15, 1, (enum ntk_charset)1000));
+}
+
+void test_CharsetAllTablesValid(void)
+{
+  char bytes[256];
+  for (int i = 0; i < 256; ++i)
+  {
+    bytes[i] = (char)i;
+  }
+
+  char out[768];
+  for (int charset = ntk_charset_iso_8859_1; charset <= ntk_charset_koi8_r; ++charset)
+  {
+    size_t outLen;
+    size_t expLen = ntk_utf8_length_from_charset(bytes, sizeof(bytes), (enum ntk_charset)charset);
+    TEST_ASSERT_TRUE(ntk_charset_to_utf8(bytes, sizeof(bytes), (enum ntk_charset)charset, out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+    TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+  }
+}
+
+void test_Cesu8(void)
+{
+  // "ntk \U0001F600 \u00E9" as CESU-8 and UTF-8
+  const char* pCesu8 = "ntk \xED\xA0\xBD\xED\xB8\x80 \xC3\xA9";
+  size_t cesu8Len = strlen(pCesu8);
+  const char* pUtf8 = "ntk \xF0\x9F\x98\x80 \xC3\xA9";
+  size_t utf8Len = strlen(pUtf8);
+
+  TEST_ASSERT_TRUE(ntk_is_cesu8(pCesu8, cesu8Len));
+  TEST_ASSERT_FALSE(ntk_is_utf8(pCesu8, cesu8Len));
+  TEST_ASSERT_FALSE(ntk_is_cesu8(pUtf8, utf8Len));
+
+  char out[32];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_cesu8_to_utf8(pCesu8, cesu8Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+
+  TEST_ASSERT_EQUAL_size_t(cesu8Len, ntk_cesu8_length_from_utf8(pUtf8, utf8Len));
+  TEST_ASSERT_TRUE(ntk_utf8_to_cesu8(pUtf8, utf8Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(cesu8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pCesu8, out, outLen);
+
+  // Lone and reversed surrogates
+  const char* pLoneHigh = "\xED\xA0\xBD abc";
+  TEST_ASSERT_FALSE(ntk_is_cesu8(pLoneHigh, strlen(pLoneHigh)));
+  const char* pLoneLow = "\xED\xB8\x80";
+  TEST_ASSERT_FALSE(ntk_is_cesu8(pLoneLow, strlen(pLoneLow)));
+  const char* pReversed = "\xED\xB8\x80\xED\xA0\xBD";
+  TEST_ASSERT_FALSE(ntk_is_cesu8(pReversed, strlen(pReversed)));
+  const char* pTruncated = "\xED\xA0\xBD\xED\xB8";
+  TEST_ASSERT_FALSE(ntk_is_cesu8(pTruncated, strlen(pTruncated)));
+
+  TEST_ASSERT_FALSE(ntk_utf8_to_cesu8(pCesu8, cesu8Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  TEST_ASSERT_FALSE(ntk_is_cesu8(NULL, 0));
+}
+
+void test_ModifiedUtf8(void)
+{
+  const char mutf8[] = {'a', (char)0xC0, (char)0x80, 'b', (char)0xED, (char)0xA0, (char)0xBD, (char)0xED, (char)0xB8,
+                        (char)0x80};
+  const char utf8[] = {'a', '\0', 'b', (char)0xF0, (char)0x9F, (char)0x98, (char)0x80};
+
+  TEST_ASSERT_TRUE(ntk_is_mutf8(mutf8, sizeof(mutf8)));
+  TEST_ASSERT_FALSE(ntk_is_cesu8(mutf8, sizeof(mutf8)));
+  TEST_ASSERT_FALSE(ntk_is_mutf8(utf8, sizeof(utf8)));
+
+  // Raw NUL is not allowed in Modified UTF-8, but is fine in CESU-8
+  const char rawNul[] = {'a', '\0', 'b'};
+  TEST_ASSERT_FALSE(ntk_is_mutf8(rawNul, sizeof(rawNul)));
+  TEST_ASSERT_TRUE(ntk_is_cesu8(rawNul, sizeof(rawNul)));
+
+  char out[32];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_mutf8_to_utf8(mutf8, sizeof(mutf8), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(utf8), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(utf8, out, outLen);
+
+  TEST_ASSERT_EQUAL_size_t(sizeof(mutf8), ntk_mutf8_length_from_utf8(utf8, sizeof(utf8)));
+  TEST_ASSERT_TRUE(ntk_utf8_to_mutf8(utf8, sizeof(utf8), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(mutf8), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(mutf8, out, outLen);
+
+  // Other overlong sequences are still rejected
+  const char* pOverlong = "\xC0\x81";
+  TEST_ASSERT_FALSE(ntk_is_mutf8(pOverlong, 2));
+}
+
+void test_Wtf8(void)
+{
+  // "a" U+D800 "b" U+1F600 U+DC00, where both surrogates are unpaired
+  const uint16_t utf16[] = {'a', 0xD800, 'b', 0xD83D, 0xDE00, 0xDC00};
+  size_t utf16Len = sizeof(utf16) / sizeof(utf16[0]);
+  const char* pWtf8 = "a\xED\xA0\x80" "b\xF0\x9F\x98\x80\xED\xB0\x80";
+  size_t wtf8Len = strlen(pWtf8);
+
+  TEST_ASSERT_TRUE(ntk_is_wtf8(pWtf8, wtf8Len));
+  TEST_ASSERT_FALSE(ntk_is_utf8(pWtf8, wtf8Len));
+
+  TEST_ASSERT_EQUAL_size_t(wtf8Len, ntk_wtf8_length_from_utf16(utf16, utf16Len));
+  char out[32];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_utf16_to_wtf8(utf16, utf16Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(wtf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pWtf8, out, outLen);
+
+  TEST_ASSERT_EQUAL_size_t(utf16Len, ntk_utf16_length_from_utf8(pWtf8, wtf8Len));
+  uint16_t back[16];
+  size_t backLen;
+  TEST_ASSERT_TRUE(ntk_wtf8_to_utf16(pWtf8, wtf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(utf16Len, backLen);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(utf16, back, utf16Len);
+
+  const char* pLossy = "a\xEF\xBF\xBD" "b\xF0\x9F\x98\x80\xEF\xBF\xBD";
+  TEST_ASSERT_TRUE(ntk_wtf8_to_utf8(pWtf8, wtf8Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(wtf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pLossy, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  // In place
+  char inPlace[32];
+  memcpy(inPlace, pWtf8, wtf8Len);
+  TEST_ASSERT_TRUE(ntk_wtf8_to_utf8(inPlace, wtf8Len, inPlace, &outLen));
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pLossy, inPlace, outLen);
+}
+
+void test_Wtf8Invalid(void)
+{
+  // A surrogate pair spelled as two three-byte sequences is CESU-8, not WTF-8
+  const char* pPair = "\xED\xA0\xBD\xED\xB8\x80";
+  TEST_ASSERT_FALSE(ntk_is_wtf8(pPair, strlen(pPair)));
+
+  // A low surrogate followed by a high surrogate is two unpaired surrogates
+  const char* pReversed = "\xED\xB8\x80\xED\xA0\xBD";
+  TEST_ASSERT_TRUE(ntk_is_wtf8(pReversed, strlen(pReversed)));
+
+  const char* pOverlong = "\xC0\x80";
+  TEST_ASSERT_FALSE(ntk_is_wtf8(pOverlong, strlen(pOverlong)));
+
+  const char* pTruncated = "abc\xED\xA0";
+  TEST_ASSERT_FALSE(ntk_is_wtf8(pTruncated, strlen(pTruncated)));
+
+  uint16_t out[8];
+  size_t outLen;
+  TEST_ASSERT_FALSE(ntk_wtf8_to_utf16(pPair, strlen(pPair), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+
+  TEST_ASSERT_TRUE(ntk_is_wtf8((const char*)uni_hannover_html, uni_hannover_html_len));
+}
+
+void test_Utf16ToUtf8Lossy(void)
+{
+  // Valid text, then a lone high surrogate, a run of two lone surrogates, and a lone low surrogate at the end
+  const uint16_t utf16[] = {'J', 'S', ' ', 0x00E9, 0x20AC, 0xD83D, 0xDE00, ' ', 0xD800, 'x',
+                            0xDC00, 0xDBFF, ' ', 'e', 'n', 'd', 0xDFFF};
+  size_t utf16Len = sizeof(utf16) / sizeof(utf16[0]);
+  const char* pExp = "JS \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 \xEF\xBF\xBDx\xEF\xBF\xBD end\xEF\xBF\xBD";
+  size_t expLen = strlen(pExp);
+
+  TEST_ASSERT_EQUAL_size_t(expLen, ntk_utf8_length_from_utf16_lossy(utf16, utf16Len));
+
+  char out[64];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_utf16_to_utf8_lossy(utf16, utf16Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  // Valid input converts exactly as the strict length helper predicts
+  const uint16_t valid[] = {'a', 'b', 'c', 'd', 0x0100, 0x0800, 0xFFFF, 0xD800, 0xDC00, 0x7F};
+  size_t validLen = sizeof(valid) / sizeof(valid[0]);
+  size_t validExpLen = ntk_utf8_length_from_utf16(valid, validLen);
+  TEST_ASSERT_EQUAL_size_t(validExpLen, ntk_utf8_length_from_utf16_lossy(valid, validLen));
+  TEST_ASSERT_TRUE(ntk_utf16_to_utf8_lossy(valid, validLen, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(validExpLen, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  TEST_ASSERT_FALSE(ntk_utf16_to_utf8_lossy(NULL, 1, out, &outLen));
+}
+
+static void to_byte_order16(const uint16_t* pIn, size_t len, int bigEndian, uint16_t* pOut)
+{
+  for (size_t i = 0; i < len; ++i)
+  {
+    unsigned char bytes[2] = {(unsigned char)(pIn[i] & 0xFFU), (unsigned char)(pIn[i] >> 8U)};
+    if (bigEndian)
+    {
+      unsigned char tmp = bytes[0];
+      bytes[0] = bytes[1];
+      bytes[1] = tmp;
+    }
+    memcpy(pOut + i, bytes, sizeof(bytes));
+  }
+}
+
+static void to_byte_order32(const uint32_t* pIn, size_t len, int bigEndian, uint32_t* pOut)
+{
+  for (size_t i = 0; i < len; ++i)
+  {
+    unsigned char bytes[4];
+    for (size_t b = 0; b < 4; ++b)
+    {
+      bytes[bigEndian ? 3 - b : b] = (unsigned char)((pIn[i] >> (8 * b)) & 0xFFU);
+    }
+    memcpy(pOut + i, bytes, sizeof(bytes));
+  }
+}
+
+void test_Utf16ByteOrders(void)
+{
+  const char* pUtf8 = "ntk: \xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 the quick brown fox";
+  size_t utf8Len = strlen(pUtf8);
+  const uint16_t utf16[] = {'n', 't', 'k', ':', ' ', 0x00E9, ' ', 0x20AC, ' ', 0xD83D, 0xDE00, ' ', 't', 'h', 'e', ' ',
+                            'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x'};
+  size_t utf16Len = sizeof(utf16) / sizeof(utf16[0]);
+
+  uint16_t le[32];
+  uint16_t be[32];
+  to_byte_order16(utf16, utf16Len, 0, le);
+  to_byte_order16(utf16, utf16Len, 1, be);
+
+  TEST_ASSERT_TRUE(ntk_is_utf16(utf16, utf16Len));
+  TEST_ASSERT_TRUE(ntk_is_utf16le(le, utf16Len));
+  TEST_ASSERT_TRUE(ntk_is_utf16be(be, utf16Len));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, ntk_utf8_length_from_utf16le(le, utf16Len));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, ntk_utf8_length_from_utf16be(be, utf16Len));
+
+  char out[64];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_utf16_to_utf8(utf16, utf16Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+  TEST_ASSERT_TRUE(ntk_utf16le_to_utf8(le, utf16Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+  TEST_ASSERT_TRUE(ntk_utf16be_to_utf8(be, utf16Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+
+  uint16_t back[32];
+  size_t backLen;
+  TEST_ASSERT_TRUE(ntk_utf8_to_utf16(pUtf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(utf16Len, backLen);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(utf16, back, utf16Len);
+  TEST_ASSERT_TRUE(ntk_utf8_to_utf16le(pUtf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(utf16Len, backLen);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(le, back, utf16Len);
+  TEST_ASSERT_TRUE(ntk_utf8_to_utf16be(pUtf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(utf16Len, backLen);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(be, back, utf16Len);
+}
+
+void test_Utf16Invalid(void)
+{
+  const uint16_t lone[] = {'a', 'b', 'c', 'd', 'e', 0xDC00, 'f'};
+  size_t loneLen = sizeof(lone) / sizeof(lone[0]);
+  uint16_t loneBe[8];
+  to_byte_order16(lone, loneLen, 1, loneBe);
+
+  TEST_ASSERT_FALSE(ntk_is_utf16(lone, loneLen));
+  TEST_ASSERT_FALSE(ntk_is_utf16be(loneBe, loneLen));
+
+  const uint16_t truncated[] = {'a', 0xD800};
+  TEST_ASSERT_FALSE(ntk_is_utf16(truncated, 2));
+
+  char out[32];
+  size_t outLen;
+  TEST_ASSERT_FALSE(ntk_utf16_to_utf8(lone, loneLen, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  TEST_ASSERT_FALSE(ntk_utf16be_to_utf8(loneBe, loneLen, out, &outLen));
+
+  uint16_t utf16[8];
+  TEST_ASSERT_FALSE(ntk_utf8_to_utf16be("a\xED\xA0\x80", 4, utf16, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+}
+
+void test_Utf32ByteOrders(void)
+{
+  const char* pUtf8 = "ntk: \xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80";
+  size_t utf8Len = strlen(pUtf8);
+  const uint32_t utf32[] = {'n', 't', 'k', ':', ' ', 0x00E9, ' ', 0x20AC, ' ', 0x1F600};
+  size_t utf32Len = sizeof(utf32) / sizeof(utf32[0]);
+
+  uint32_t le[16];
+  uint32_t be[16];
+  to_byte_order32(utf32, utf32Len, 0, le);
+  to_byte_order32(utf32, utf32Len, 1, be);
+
+  TEST_ASSERT_TRUE(ntk_is_utf32(utf32, utf32Len));
+  TEST_ASSERT_TRUE(ntk_is_utf32le(le, utf32Len));
+  TEST_ASSERT_TRUE(ntk_is_utf32be(be, utf32Len));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, ntk_utf8_length_from_utf32le(le, utf32Len));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, ntk_utf8_length_from_utf32be(be, utf32Len));
+
+  char out[64];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_utf32_to_utf8(utf32, utf32Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+  TEST_ASSERT_TRUE(ntk_utf32le_to_utf8(le, utf32Len, out, &outLen));
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+  TEST_ASSERT_TRUE(ntk_utf32be_to_utf8(be, utf32Len, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(utf8Len, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pUtf8, out, outLen);
+
+  uint32_t back[16];
+  size_t backLen;
+  TEST_ASSERT_TRUE(ntk_utf8_to_utf32(pUtf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(utf32Len, backLen);
+  TEST_ASSERT_EQUAL_HEX32_ARRAY(utf32, back, utf32Len);
+  TEST_ASSERT_TRUE(ntk_utf8_to_utf32le(pUtf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_HEX32_ARRAY(le, back, utf32Len);
+  TEST_ASSERT_TRUE(ntk_utf8_to_utf32be(pUtf8, utf8Len, back, &backLen));
+  TEST_ASSERT_EQUAL_size_t(utf32Len, backLen);
+  TEST_ASSERT_EQUAL_HEX32_ARRAY(be, back, utf32Len);
+
+  // Surrogates and values past U+10FFFF
+  const uint32_t surrogate[] = {'a', 0xD800};
+  TEST_ASSERT_FALSE(ntk_is_utf32(surrogate, 2));
+  const uint32_t tooBig[] = {0x110000};
+  TEST_ASSERT_FALSE(ntk_is_utf32(tooBig, 1));
+  TEST_ASSERT_FALSE(ntk_utf32_to_utf8(tooBig, 1, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+}
+
+void test_SniffBom(void)
+{
+  struct ntk_encoding_guess guesses[4];
+
+  TEST_ASSERT_EQUAL_size_t(1, ntk_sniff_encoding("\xEF\xBB\xBFntk", 6, guesses, 4));
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf8, guesses[0].encoding);
+  TEST_ASSERT_EQUAL_INT(100, guesses[0].confidence);
+  TEST_ASSERT_EQUAL_size_t(3, guesses[0].bomLen);
+
+  TEST_ASSERT_EQUAL_size_t(1, ntk_sniff_encoding("\xFF\xFEn\0", 4, guesses, 4));
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf16le, guesses[0].encoding);
+  TEST_ASSERT_EQUAL_size_t(2, guesses[0].bomLen);
+
+  TEST_ASSERT_EQUAL_size_t(1, ntk_sniff_encoding("\xFE\xFF\0n", 4, guesses, 4));
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf16be, guesses[0].encoding);
+
+  TEST_ASSERT_EQUAL_size_t(1, ntk_sniff_encoding("\xFF\xFE\0\0", 4, guesses, 4));
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf32le, guesses[0].encoding);
+  TEST_ASSERT_EQUAL_size_t(4, guesses[0].bomLen);
+
+  TEST_ASSERT_EQUAL_size_t(1, ntk_sniff_encoding("\0\0\xFE\xFF", 4, guesses, 4));
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf32be, guesses[0].encoding);
+
+  TEST_ASSERT_EQUAL_size_t(0, ntk_sniff_encoding(NULL, 4, guesses, 4));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_sniff_encoding("ntk", 3, guesses, 0));
+}
+
+void test_SniffUnicode(void)
+{
+  struct ntk_encoding_guess guesses[8];
+
+  size_t count = ntk_sniff_encoding((const char*)uni_hannover_html, uni_hannover_html_len, guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf8, guesses[0].encoding);
+  TEST_ASSERT_TRUE(guesses[0].confidence >= 90);
+
+  const char utf16le[] = "N\0i\0c\0k\0'\0s\0 \0T\0e\0x\0t\0 \0K\0i\0t\0";
+  count = ntk_sniff_encoding(utf16le, sizeof(utf16le) - 1, guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf16le, guesses[0].encoding);
+
+  const char utf16be[] = "\0N\0i\0c\0k\0'\0s\0 \0T\0e\0x\0t\0 \0K\0i\0t";
+  count = ntk_sniff_encoding(utf16be, sizeof(utf16be) - 1, guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf16be, guesses[0].encoding);
+
+  const char utf32le[] = "N\0\0\0i\0\0\0c\0\0\0k\0\0\0\xE9\0\0\0";
+  count = ntk_sniff_encoding(utf32le, sizeof(utf32le) - 1, guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_utf32le, guesses[0].encoding);
+}
+
+void test_SniffSingleByte(void)
+{
+  struct ntk_encoding_guess guesses[8];
+
+  // Windows-1252 curly quotes are C1 controls in ISO-8859-1
+  const char* pWindows1252 = "The caf\xE9 said \x93no r\xE9sum\xE9s\x94, so we left";
+  size_t count = ntk_sniff_encoding(pWindows1252, strlen(pWindows1252), guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_encoding_single_byte, guesses[0].encoding);
+  TEST_ASSERT_EQUAL_INT(ntk_charset_windows_1252, guesses[0].charset);
+
+  // Mostly lowercase Russian tells Windows-1251 and KOI8-R apart, and 0xFF (\u044F) is unassigned in Windows-1253
+  const char* pWindows1251 = "\xcf\xf0\xe8\xe2\xe5\xf2, \xec\xe8\xf0! \xdd\xf2\xee \xf2\xe5\xf1\xf2\xee\xe2\xe0\xff "
+                             "\xf1\xf2\xf0\xee\xea\xe0 \xe4\xeb\xff \xef\xf0\xee\xe2\xe5\xf0\xea\xe8.";
+  count = ntk_sniff_encoding(pWindows1251, strlen(pWindows1251), guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_charset_windows_1251, guesses[0].charset);
+
+  const char* pKoi8 = "\xf0\xd2\xc9\xd7\xc5\xd4, \xcd\xc9\xd2! \xfc\xd4\xcf \xd4\xc5\xd3\xd4\xcf\xd7\xc1\xd1 "
+                      "\xd3\xd4\xd2\xcf\xcb\xc1 \xc4\xcc\xd1 \xd0\xd2\xcf\xd7\xc5\xd2\xcb\xc9.";
+  count = ntk_sniff_encoding(pKoi8, strlen(pKoi8), guesses, 8);
+  TEST_ASSERT_TRUE(count >= 1);
+  TEST_ASSERT_EQUAL_INT(ntk_charset_koi8_r, guesses[0].charset);
+
+  // Guesses are ranked and limited to the caller's capacity
+  count = ntk_sniff_encoding(pWindows1252, strlen(pWindows1252), guesses, 2);
+  TEST_ASSERT_EQUAL_size_t(2, count);
+  TEST_ASSERT_TRUE(guesses[0].confidence >= guesses[1].confidence);
+}
+
+struct multibyte_sample
+{
+  enum ntk_multibyte_charset charset;
+  const char* pIn;
+  const char* pExp;
+};
+
+// Generated with Python's cp932, euc_jp, gb18030, cp950 and cp949 codecs
+static const struct multibyte_sample multibyte_samples[] = {
+  // "日本語ｶﾀｶﾅ テキスト①"
+  {ntk_multibyte_shift_jis, "\x93\xFA\x96{\x8C\xEA\xB6\xC0\xB6\xC5 \x83" "e\x83L\x83X\x83g\x87@",
+   "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xEF\xBD\xB6\xEF\xBE\x80\xEF\xBD\xB6\xEF\xBE\x85 "
+   "\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88\xE2\x91\xA0"},
+  // "日本語ｶﾀｶﾅ 丂テキスト", with 丂 from JIS X 0212
+  {ntk_multibyte_euc_jp,
+   "\xC6\xFC\xCB\xDC\xB8\xEC\x8E\xB6\x8E\xC0\x8E\xB6\x8E\xC5 \x8F\xB0\xA1\xA5\xC6\xA5\xAD\xA5\xB9\xA5\xC8",
+   "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xEF\xBD\xB6\xEF\xBE\x80\xEF\xBD\xB6\xEF\xBE\x85 "
+   "\xE4\xB8\x82\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88"},
+  // "中文 €文本 ḿ😀", where ḿ and 😀 are four-byte sequences
+  {ntk_multibyte_gb18030, "\xD6\xD0\xCE\xC4 \xA2\xE3\xCE\xC4\xB1\xBE \x81" "5\xF4" "7\x94" "9\xFC" "6",
+   "\xE4\xB8\xAD\xE6\x96\x87 \xE2\x82\xAC\xE6\x96\x87\xE6\x9C\xAC \xE1\xB8\xBF\xF0\x9F\x98\x80"},
+  // "繁體中文 測試"
+  {ntk_multibyte_big5, "\xC1" "c\xC5\xE9\xA4\xA4\xA4\xE5 \xB4\xFA\xB8\xD5",
+   "\xE7\xB9\x81\xE9\xAB\x94\xE4\xB8\xAD\xE6\x96\x87 \xE6\xB8\xAC\xE8\xA9\xA6"},
+  // "한국어 똠방각하 test", where 똠 is outside the KS X 1001 set
+  {ntk_multibyte_euc_kr, "\xC7\xD1\xB1\xB9\xBE\xEE \x8C" "c\xB9\xE6\xB0\xA2\xC7\xCF test",
+   "\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4 \xEB\x98\xA0\xEB\xB0\xA9\xEA\xB0\x81\xED\x95\x98 test"},
+};
+
+void test_MultibyteCharsets(void)
+{
+  for (size_t i = 0; i < sizeof(multibyte_samples) / sizeof(multibyte_samples[0]); ++i)
+  {
+    const struct multibyte_sample* pSample = &multibyte_samples[i];
+    size_t inLen = strlen(pSample->pIn);
+    size_t expLen = strlen(pSample->pExp);
+
+    TEST_ASSERT_EQUAL_size_t(expLen, ntk_utf8_length_from_multibyte(pSample->pIn, inLen, pSample->charset));
+
+    char out[128];
+    size_t outLen;
+    TEST_ASSERT_TRUE(ntk_multibyte_to_utf8(pSample->pIn, inLen, pSample->charset, out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(pSample->pExp, out, expLen);
+  }
+}
+
+static void check_multibyte(enum ntk_multibyte_charset charset, const char* pIn, size_t inLen, const char* pExp)
+{
+  char out[64];
+  size_t outLen;
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_utf8_length_from_multibyte(pIn, inLen, charset));
+  TEST_ASSERT_TRUE(ntk_multibyte_to_utf8(pIn, inLen, charset, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+}
+
+void test_MultibyteInvalid(void)
+{
+  // Truncated at the end of the input
+  check_multibyte(ntk_multibyte_shift_jis, "a\x93", 2, "a\xEF\xBF\xBD");
+  check_multibyte(ntk_multibyte_euc_jp, "a\x8F\xB0", 3, "a\xEF\xBF\xBD");
+  check_multibyte(ntk_multibyte_gb18030, "a\x81\x35\xF4", 4, "a\xEF\xBF\xBD" "5\xEF\xBF\xBD");
+
+  // An ASCII byte which cannot continue the sequence is kept
+  check_multibyte(ntk_multibyte_shift_jis, "\x93 x", 3, "\xEF\xBF\xBD x");
+  check_multibyte(ntk_multibyte_euc_kr, "\xB0" "1", 2, "\xEF\xBF\xBD" "1");
+  check_multibyte(ntk_multibyte_big5, "\xA4" "\x7F", 2, "\xEF\xBF\xBD\x7F");
+  check_multibyte(ntk_multibyte_gb18030, "\x81\x30\x81 ", 4, "\xEF\xBF\xBD" "0\xEF\xBF\xBD ");
+
+  // Consecutive invalid or unmapped sequences collapse into one U+FFFD
+  check_multibyte(ntk_multibyte_shift_jis, "\xFD\xFE\xA0", 3, "\xEF\xBF\xBD");
+  check_multibyte(ntk_multibyte_euc_jp, "\xA9\xA1\xFF\x8E\xE0", 5, "\xEF\xBF\xBD");
+  check_multibyte(ntk_multibyte_big5, "\xFA\x40\x80", 3, "\xEF\xBF\xBD" "@\xEF\xBF\xBD");
+  check_multibyte(ntk_multibyte_gb18030, "\xFF\x84\x31\xA5\x30", 5, "\xEF\xBF\xBD" "1\xEF\xBF\xBD" "0");
+
+  // Single-byte extras
+  check_multibyte(ntk_multibyte_gb18030, "\x80", 1, "\xE2\x82\xAC");
+  check_multibyte(ntk_multibyte_shift_jis, "\x80\xDF", 2, "\xC2\x80\xEF\xBE\x9F");
+
+  char out[8];
+  size_t outLen;
+  TEST_ASSERT_FALSE(ntk_multibyte_to_utf8(NULL, 0, ntk_multibyte_big5, out, &outLen));
+  TEST_ASSERT_FALSE(ntk_multibyte_to_utf8("a", 1, (enum ntk_multibyte_charset)99, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_utf8_length_from_multibyte(NULL, 5, ntk_multibyte_big5));
+}
+
+void test_MultibyteStreaming(void)
+{
+  for (size_t i = 0; i < sizeof(multibyte_samples) / sizeof(multibyte_samples[0]); ++i)
+  {
+    const struct multibyte_sample* pSample = &multibyte_samples[i];
+    size_t inLen = strlen(pSample->pIn);
+    size_t expLen = strlen(pSample->pExp);
+    char out[256];
+    size_t outLen;
+    size_t chunkLen;
+    struct ntk_multibyte_decoder decoder;
+
+    // Split into two chunks at every position
+    for (size_t split = 0; split <= inLen; ++split)
+    {
+      ntk_multibyte_decoder_init(&decoder, pSample->charset);
+      TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, pSample->pIn, split, 0, out, &outLen));
+      TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, pSample->pIn + split, inLen - split, 1, out + outLen, &chunkLen));
+      outLen += chunkLen;
+      TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+      TEST_ASSERT_EQUAL_CHAR_ARRAY(pSample->pExp, out, expLen);
+    }
+
+    // One byte at a time, finishing with an empty chunk
+    ntk_multibyte_decoder_init(&decoder, pSample->charset);
+    outLen = 0;
+
+    for (size_t j = 0; j < inLen; ++j)
+    {
+      TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, pSample->pIn + j, 1, 0, out + outLen, &chunkLen));
+      outLen += chunkLen;
+    }
+
+    TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, NULL, 0, 1, out + outLen, &chunkLen));
+    outLen += chunkLen;
+    TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(pSample->pExp, out, expLen);
+  }
+
+  // A sequence left incomplete by the final chunk, and a run of errors spanning chunks
+  struct ntk_multibyte_decoder decoder;
+  char out[32];
+  size_t outLen;
+  size_t chunkLen;
+  ntk_multibyte_decoder_init(&decoder, ntk_multibyte_gb18030);
+  TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, "\xFF", 1, 0, out, &outLen));
+  TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, "\xFF\x81\x30", 3, 0, out + outLen, &chunkLen));
+  outLen += chunkLen;
+  TEST_ASSERT_TRUE(ntk_multibyte_decode(&decoder, "\x81", 1, 1, out + outLen, &chunkLen));
+  outLen += chunkLen;
+  TEST_ASSERT_EQUAL_size_t(7, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("\xEF\xBF\xBD" "0\xEF\xBF\xBD", out, outLen);
+}
+
+void test_EscapeHtml(void)
+{
+  const char* pIn = "<a href=\"x\">Tom & Jerry's</a> caf\xC3\xA9";
+  const char* pExp = "&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&#39;s&lt;/a&gt; caf\xC3\xA9";
+  size_t inLen = strlen(pIn);
+  size_t expLen = strlen(pExp);
+
+  TEST_ASSERT_EQUAL_size_t(expLen, ntk_escape_html_length(pIn, inLen));
+
+  char out[128];
+  size_t outLen;
+  TEST_ASSERT_TRUE(ntk_escape_html(pIn, inLen, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, expLen);
+
+  char* pAlloc = ntk_escape_html_alloc(pIn, inLen, &outLen);
+  TEST_ASSERT_NOT_NULL(pAlloc);
+  TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, pAlloc, expLen);
+  free(pAlloc);
+
+  // Clean input longer than a word is copied unchanged, and specials are found at every offset within a word
+  const char* pClean = "The quick brown fox jumps over the lazy dog";
+  TEST_ASSERT_TRUE(ntk_escape_html(pClean, strlen(pClean), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pClean), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pClean, out, outLen);
+
+  for (size_t offset = 0; offset < 16; ++offset)
+  {
+    char in[17];
+    memset(in, 'x', sizeof(in));
+    in[offset] = '>';
+    TEST_ASSERT_EQUAL_size_t(sizeof(in) + 3, ntk_escape_html_length(in, sizeof(in)));
+    TEST_ASSERT_TRUE(ntk_escape_html(in, sizeof(in), out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(sizeof(in) + 3, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY("&gt;", out + offset, 4);
+  }
+
+  TEST_ASSERT_FALSE(ntk_escape_html(NULL, 0, out, &outLen));
+  TEST_ASSERT_NULL(ntk_escape_html_alloc(pIn, 0, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+}
+
+void test_EscapeHtmlAttribute(void)
+{
+  const char* pIn = "a \"b\" & 'c' <d>=`e`\t";
+  size_t inLen = strlen(pIn);
+  const char* pExp[] = {
+    "a &quot;b&quot; &amp; 'c' <d>=`e`\t",
+    "a \"b\" &amp; &#39;c&#39; <d>=`e`\t",
+    "a&#32;&quot;b&quot;&#32;&amp;&#32;&#39;c&#39;&#32;&lt;d&gt;&#61;&#96;e&#96;&#9;",
+  };
+  char out[128];
+  size_t outLen;
+
+  for (int attribute = 0; attribute < 3; ++attribute)
+  {
+    size_t expLen = strlen(pExp[attribute]);
+    TEST_ASSERT_EQUAL_size_t(expLen, ntk_escape_html_attribute_length(pIn, inLen, (enum ntk_html_attribute)attribute));
+    TEST_ASSERT_TRUE(ntk_escape_html_attribute(pIn, inLen, (enum ntk_html_attribute)attribute, out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp[attribute], out, expLen);
+
+    char* pAlloc = ntk_escape_html_attribute_alloc(pIn, inLen, (enum ntk_html_attribute)attribute, &outLen);
+    TEST_ASSERT_NOT_NULL(pAlloc);
+    TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp[attribute], pAlloc, expLen);
+    free(pAlloc);
+  }
+
+  // Control characters are only found by the unquoted escaper, at any offset within a word; UTF-8 passes through
+  const char pControls[] = "\x01\x1F" "abcdefgh\x7F\xC3\xA9\0";
+  const char* pControlsExp = "&#1;&#31;abcdefgh\x7F\xC3\xA9&#65533;";
+  TEST_ASSERT_TRUE(ntk_escape_html_attribute(pControls, sizeof(pControls) - 1, ntk_html_attribute_unquoted, out,
+                                             &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pControlsExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pControlsExp, out, outLen);
+  TEST_ASSERT_TRUE(ntk_escape_html_attribute(pControls, sizeof(pControls) - 1, ntk_html_attribute_double_quoted,
+                                             out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(pControls) - 1, outLen);
+
+  TEST_ASSERT_FALSE(ntk_escape_html_attribute(pIn, inLen, (enum ntk_html_attribute)3, out, &outLen));
+  TEST_ASSERT_NULL(ntk_escape_html_attribute_alloc(pIn, inLen, (enum ntk_html_attribute)3, &outLen));
+}
+
+void test_EscapeUrl(void)
+{
+  const char* pIn = "a b/c?d=e&f:g@h~%\xC3\xA9\xF0\x9F\x98\x80";
+  size_t inLen = strlen(pIn);
+  const char* pExp[] = {
+    "a%20b%2Fc%3Fd=e&f:g@h~%25%C3%A9%F0%9F%98%80",
+    "a%20b/c?d=e&f:g@h~%25%C3%A9%F0%9F%98%80",
+    "a%20b/c?d=e&f:g@h~%25%C3%A9%F0%9F%98%80",
+    "a%20b%2Fc%3Fd=e&f%3Ag%40h~%25%C3%A9%F0%9F%98%80",
+    "a+b%2Fc%3Fd%3De%26f%3Ag%40h%7E%25%C3%A9%F0%9F%98%80",
+  };
+  char out[128];
+  size_t outLen;
+
+  for (int component = 0; component < 5; ++component)
+  {
+    size_t expLen = strlen(pExp[component]);
+    TEST_ASSERT_EQUAL_size_t(expLen, ntk_escape_url_length(pIn, inLen, (enum ntk_url_component)component));
+    TEST_ASSERT_TRUE(ntk_escape_url(pIn, inLen, (enum ntk_url_component)component, out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp[component], out, expLen);
+  }
+
+  // Alphanumeric words are skipped whole
+  const char* pClean = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-._~";
+  TEST_ASSERT_TRUE(ntk_escape_url(pClean, strlen(pClean), ntk_url_path_segment, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pClean), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pClean, out, outLen);
+
+  // Invalid UTF-8 is rejected: truncated, surrogate, overlong and stray continuation
+  const char* pInvalid[] = {"abc\xC3", "\xED\xA0\x80", "\xC0\xAF", "ab\x80" "cd"};
+  for (size_t i = 0; i < sizeof(pInvalid) / sizeof(pInvalid[0]); ++i)
+  {
+    TEST_ASSERT_FALSE(ntk_escape_url(pInvalid[i], strlen(pInvalid[i]), ntk_url_query, out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(0, outLen);
+  }
+
+  TEST_ASSERT_FALSE(ntk_escape_url(pIn, inLen, (enum ntk_url_component)5, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_escape_url_length(NULL, 3, ntk_url_query));
+  TEST_ASSERT_EQUAL_size_t(0, ntk_escape_url_length("a b\xC3", 4, ntk_url_query));
+}
+
+void test_UnescapeUrl(void)
+{
+  const char* pIn = "caf%C3%a9+au+lait%20%F0%9F%98%80 \xC3\xA9%zz%4";
+  size_t inLen = strlen(pIn);
+  char out[64];
+  size_t outLen;
+
+  const char* pExp = "caf\xC3\xA9+au+lait \xF0\x9F\x98\x80 \xC3\xA9%zz%4";
+  TEST_ASSERT_TRUE(ntk_unescape_url(pIn, inLen, 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  const char* pFormExp = "caf\xC3\xA9 au lait \xF0\x9F\x98\x80 \xC3\xA9%zz%4";
+  TEST_ASSERT_TRUE(ntk_unescape_url(pIn, inLen, 1, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pFormExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pFormExp, out, outLen);
+
+  // In place, with a long clean prefix that stays where it is
+  char inPlace[] = "abcdefghijklmnopqrstuvwxyz%2Fabcdefghijklmnopqrstuvwxyz";
+  TEST_ASSERT_TRUE(ntk_unescape_url(inPlace, strlen(inPlace), 0, inPlace, &outLen));
+  TEST_ASSERT_EQUAL_size_t(53, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("abcdefghijklmnopqrstuvwxyz/abcdefghijklmnopqrstuvwxyz", inPlace, outLen);
+
+  // Decoded bytes must form valid UTF-8, including across a mix of escaped and raw bytes
+  const char* pInvalid[] = {"%C3", "%C3%28", "%ED%A0%80", "%C0%AF", "%E0%E0%80", "\xC3%28", "%80abc"};
+  for (size_t i = 0; i < sizeof(pInvalid) / sizeof(pInvalid[0]); ++i)
+  {
+    TEST_ASSERT_FALSE(ntk_unescape_url(pInvalid[i], strlen(pInvalid[i]), 0, out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(0, outLen);
+  }
+
+  TEST_ASSERT_TRUE(ntk_unescape_url("%C3%A9", 6, 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(2, outLen);
+  TEST_ASSERT_FALSE(ntk_unescape_url(NULL, 0, 0, out, &outLen));
+}
+
+void test_EscapeC(void)
+{
+  const char pIn[] = "Say \"hi\"\\\n\ttab ?? ?\x1B" "7\x1B" "g\0" "caf\xC3\xA9\x7F";
+  size_t inLen = sizeof(pIn) - 1;
+  const char* pExp = "Say \\\"hi\\\"\\\\\\n\\ttab ?\\? ?\\0337\\x1Bg\\000caf\\xC3\\xA9\\x7F";
+  size_t expLen = strlen(pExp);
+  char out[128];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(expLen, ntk_escape_c_length(pIn, inLen));
+  TEST_ASSERT_TRUE(ntk_escape_c(pIn, inLen, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(expLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, expLen);
+
+  // Round trip, in place
+  TEST_ASSERT_TRUE(ntk_unescape_c(out, outLen, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(inLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pIn, out, inLen);
+
+  // Every byte value survives a round trip, including before a hexadecimal digit
+  char all[512];
+  for (size_t i = 0; i < 256; ++i)
+  {
+    all[2 * i] = (char)i;
+    all[2 * i + 1] = 'f';
+  }
+  char escaped[2048];
+  char unescaped[512];
+  TEST_ASSERT_TRUE(ntk_escape_c(all, sizeof(all), escaped, &outLen));
+  TEST_ASSERT_EQUAL_size_t(ntk_escape_c_length(all, sizeof(all)), outLen);
+  TEST_ASSERT_TRUE(ntk_unescape_c(escaped, outLen, unescaped, &outLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(all), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(all, unescaped, sizeof(all));
+}
+
+void test_UnescapeC(void)
+{
+  const char* pIn = "\\a\\b\\f\\v\\'\\?\\1\\12\\1234\\x41\\u00E9\\U0001F600 plain";
+  const char* pExp = "\a\b\f\v'?\x01\x0A" "S4A\xC3\xA9\xF0\x9F\x98\x80 plain";
+  char out[64];
+  size_t outLen;
+
+  TEST_ASSERT_TRUE(ntk_unescape_c(pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  const char* pInvalid[] = {
+    "\\", "ab\\", "\\q", "\\x", "\\x100", "\\400", "\\u12", "\\uD800", "\\U00110000", "\\u12G4",
+  };
+  for (size_t i = 0; i < sizeof(pInvalid) / sizeof(pInvalid[0]); ++i)
+  {
+    TEST_ASSERT_FALSE(ntk_unescape_c(pInvalid[i], strlen(pInvalid[i]), out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(0, outLen);
+  }
+}
+
+void test_EscapeJson(void)
+{
+  const char pIn[] = "Say \"hi\"\\\n\t\x01\x1F\b\f\r\0 caf\xC3\xA9 \xE2\x80\xA8\xE2\x80\xA9 \xF0\x9F\x98\x80</";
+  size_t inLen = sizeof(pIn) - 1;
+  const char* pExp = "Say \\\"hi\\\"\\\\\\n\\t\\u0001\\u001F\\b\\f\\r\\u0000 caf\xC3\xA9 \xE2\x80\xA8\xE2\x80\xA9 "
+                     "\xF0\x9F\x98\x80</";
+  const char* pSepExp = "Say \\\"hi\\\"\\\\\\n\\t\\u0001\\u001F\\b\\f\\r\\u0000 caf\xC3\xA9 \\u2028\\u2029 "
+                        "\xF0\x9F\x98\x80</";
+  char out[128];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_escape_json_length(pIn, inLen, 0));
+  TEST_ASSERT_TRUE(ntk_escape_json(pIn, inLen, 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pSepExp), ntk_escape_json_length(pIn, inLen, 1));
+  TEST_ASSERT_TRUE(ntk_escape_json(pIn, inLen, 1, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pSepExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pSepExp, out, outLen);
+
+  // Invalid UTF-8 is rejected, or replaced when sanitizing: one U+FFFD per run of invalid sequences, resuming at the
+  // byte which broke a sequence
+  const char* pInvalid = "a\xC3(b\xFF\xFE\xE2\x82\"\xED\xA0\x80z\xF0\x9F\x98";
+  const char* pSanitized = "a\xEF\xBF\xBD(b\xEF\xBF\xBD\\\"\xEF\xBF\xBDz\xEF\xBF\xBD";
+  TEST_ASSERT_FALSE(ntk_escape_json(pInvalid, strlen(pInvalid), 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  TEST_ASSERT_EQUAL_size_t(strlen(pSanitized), ntk_escape_json_length(pInvalid, strlen(pInvalid), 0));
+  TEST_ASSERT_TRUE(ntk_escape_json_sanitized(pInvalid, strlen(pInvalid), 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pSanitized), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pSanitized, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  TEST_ASSERT_FALSE(ntk_escape_json_sanitized(NULL, 0, 0, out, &outLen));
+}
+
+void test_UnescapeJson(void)
+{
+  const char* pIn = "Say \\\"hi\\\" \\\\ \\/ \\b\\f\\n\\r\\t \\u00e9\\u00E9 \\u2028 \\uD83D\\uDE00 "
+                    "caf\xC3\xA9 \\u0000!";
+  const char pExp[] = "Say \"hi\" \\ / \b\f\n\r\t \xC3\xA9\xC3\xA9 \xE2\x80\xA8 \xF0\x9F\x98\x80 caf\xC3\xA9 \0!";
+  char out[128];
+  size_t outLen;
+
+  TEST_ASSERT_TRUE(ntk_unescape_json(pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(pExp) - 1, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  // Round trip through the escaper, decoding in place
+  char buffer[256];
+  TEST_ASSERT_TRUE(ntk_escape_json(pExp, sizeof(pExp) - 1, 1, buffer, &outLen));
+  TEST_ASSERT_TRUE(ntk_unescape_json(buffer, outLen, buffer, &outLen));
+  TEST_ASSERT_EQUAL_size_t(sizeof(pExp) - 1, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, buffer, outLen);
+
+  // Incomplete, unknown and unpaired escapes, unescaped quotes and control characters, and invalid UTF-8
+  const char* pInvalid[] = {
+    "\\", "\\x", "\\u12", "\\u12G4", "\\uD83D", "\\uD83Dx", "\\uD83D\\n", "\\uD83D\\u0041", "\\uDE00",
+    "a\"b", "a\nb", "\xC3", "\xED\xA0\x80", "\xE0\xE0\x80",
+  };
+  for (size_t i = 0; i < sizeof(pInvalid) / sizeof(pInvalid[0]); ++i)
+  {
+    TEST_ASSERT_FALSE(ntk_unescape_json(pInvalid[i], strlen(pInvalid[i]), out, &outLen));
+    TEST_ASSERT_EQUAL_size_t(0, outLen);
+  }
+}
+
+void test_EscapeXml(void)
+{
+  const char pIn[] = "<a b=\"c\">'d' & e</a>\t\r\n\x01\x1F\0 \xEF\xBF\xBE\xEF\xBF\xBF\xEF\xBF\xBD "
+                     "\xC3(\xFF\xFE \xC2\x85";
+  size_t inLen = sizeof(pIn) - 1;
+  const char* pDropped = "&lt;a b=&quot;c&quot;&gt;&apos;d&apos; &amp; e&lt;/a&gt;\t\r\n \xEF\xBF\xBD \xEF\xBF\xBD("
+                         "\xEF\xBF\xBD \xC2\x85";
+  const char* pReplaced = "&lt;a b=&quot;c&quot;&gt;&apos;d&apos; &amp; e&lt;/a&gt;\t\r\n"
+                          "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD \xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD \xEF\xBF\xBD("
+                          "\xEF\xBF\xBD \xC2\x85";
+  char out[256];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pDropped), ntk_escape_xml_length(pIn, inLen, 0));
+  TEST_ASSERT_TRUE(ntk_escape_xml(pIn, inLen, 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pDropped), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pDropped, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pReplaced), ntk_escape_xml_length(pIn, inLen, 1));
+  TEST_ASSERT_TRUE(ntk_escape_xml(pIn, inLen, 1, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pReplaced), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pReplaced, out, outLen);
+
+  TEST_ASSERT_FALSE(ntk_escape_xml(NULL, 0, 0, out, &outLen));
+}
+
+void test_UnescapeHtml(void)
+{
+  const char* pIn = "&lt;p&gt; &amp;amp; &copy &notit; &notin; &#233;&#xE9;&#X1F600;&#128;&#129;&#0;&#x110000;"
+                    "&#xD800;&#65 &NotEqualTilde; &bogus; & &# &#x; caf\xC3\xA9";
+  const char* pExp = "<p> &amp; \xC2\xA9 \xC2\xACit; \xE2\x88\x89 \xC3\xA9\xC3\xA9\xF0\x9F\x98\x80\xE2\x82\xAC\xC2\x81"
+                     "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD" "A \xE2\x89\x82\xCC\xB8 &bogus; & &# &#x; caf\xC3\xA9";
+  char out[256];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_unescape_html_length(pIn, strlen(pIn), 0));
+  TEST_ASSERT_TRUE(ntk_unescape_html(pIn, strlen(pIn), 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+  TEST_ASSERT_TRUE(ntk_is_utf8(out, outLen));
+
+  // Legacy names without a semicolon are left alone in attributes when followed by = or an alphanumeric
+  const char* pAttr = "?a=1&copy=2&copyx&copy;&copy.";
+  const char* pAttrExp = "?a=1&copy=2&copyx\xC2\xA9\xC2\xA9.";
+  TEST_ASSERT_TRUE(ntk_unescape_html(pAttr, strlen(pAttr), 1, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pAttrExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pAttrExp, out, outLen);
+
+  // Every escaped character round trips, in place
+  char buffer[64];
+  const char* pText = "<a href=\"x\">Tom & Jerry's</a>";
+  TEST_ASSERT_TRUE(ntk_escape_html(pText, strlen(pText), buffer, &outLen));
+  TEST_ASSERT_TRUE(ntk_unescape_html(buffer, outLen, 0, buffer, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pText), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pText, buffer, outLen);
+
+  // &nGt; grows, which only fails in place when nothing before it has shrunk
+  char grows[] = "&nGt;x";
+  TEST_ASSERT_EQUAL_size_t(7, ntk_unescape_html_length(grows, 6, 0));
+  TEST_ASSERT_FALSE(ntk_unescape_html(grows, 6, 0, grows, &outLen));
+  char shrinks[] = "&lt;&nGt;x";
+  TEST_ASSERT_TRUE(ntk_unescape_html(shrinks, 10, 0, shrinks, &outLen));
+  TEST_ASSERT_EQUAL_size_t(8, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("<\xE2\x89\xAB\xE2\x83\x92x", shrinks, outLen);
+
+  TEST_ASSERT_FALSE(ntk_unescape_html("&amp;\xC3", 6, 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+}
+
+void test_EscapeShell(void)
+{
+  const char* pIn = "it's $HOME `id` \"\\\n caf\xC3\xA9 \xFF\xFE";
+  const char* pExp = "'it'\\''s $HOME `id` \"\\\n caf\xC3\xA9 \xEF\xBF\xBD'";
+  char out[64];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_escape_shell_length(pIn, strlen(pIn)));
+  TEST_ASSERT_TRUE(ntk_escape_shell(pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  TEST_ASSERT_TRUE(ntk_escape_shell("", 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(2, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("''", out, outLen);
+
+  TEST_ASSERT_TRUE(ntk_escape_shell("a\0b''", 5, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(15, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("'a\xEF\xBF\xBD" "b'\\'''\\'''", out, outLen);
+
+  const char* args[] = {"grep", "-e", "a b", "it's"};
+  const size_t lens[] = {4, 2, 3, 4};
+  const char* pArgsExp = "'grep' '-e' 'a b' 'it'\\''s'";
+  TEST_ASSERT_EQUAL_size_t(strlen(pArgsExp), ntk_escape_shell_args_length(args, lens, 4));
+  TEST_ASSERT_TRUE(ntk_escape_shell_args(args, lens, 4, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pArgsExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pArgsExp, out, outLen);
+
+  TEST_ASSERT_TRUE(ntk_escape_shell_args(args, lens, 0, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  args[1] = NULL;
+  TEST_ASSERT_EQUAL_size_t(0, ntk_escape_shell_args_length(args, lens, 4));
+  TEST_ASSERT_FALSE(ntk_escape_shell_args(args, lens, 4, out, &outLen));
+}
+
+void test_EscapeCsv(void)
+{
+  char out[128];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(11, ntk_escape_csv_length("caf\xC3\xA9 \xFF" "ok", 9));
+  TEST_ASSERT_TRUE(ntk_escape_csv("caf\xC3\xA9 \xFF" "ok", 9, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(11, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("caf\xC3\xA9 \xEF\xBF\xBDok", out, outLen);
+
+  const char* pIn = "say \"hi\", then\r\nleave";
+  const char* pExp = "\"say \"\"hi\"\", then\r\nleave\"";
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_escape_csv_length(pIn, strlen(pIn)));
+  TEST_ASSERT_TRUE(ntk_escape_csv(pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  const char* fields[] = {"id", "", "a,b", "\""};
+  const size_t lens[] = {2, 0, 3, 1};
+  const char* pRecordExp = "id,,\"a,b\",\"\"\"\"\r\n";
+  TEST_ASSERT_EQUAL_size_t(strlen(pRecordExp), ntk_escape_csv_record_length(fields, lens, 4));
+  TEST_ASSERT_TRUE(ntk_escape_csv_record(fields, lens, 4, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pRecordExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pRecordExp, out, outLen);
+
+  fields[2] = NULL;
+  TEST_ASSERT_EQUAL_size_t(0, ntk_escape_csv_record_length(fields, lens, 4));
+  TEST_ASSERT_FALSE(ntk_escape_csv_record(fields, lens, 4, out, &outLen));
+}
+
+void test_UnescapeCsv(void)
+{
+  char record[] = "plain,\"say \"\"hi\"\", then\r\nleave\",,\"\"\r\nnext";
+  const char* expected[] = {"plain", "say \"hi\", then\r\nleave", "", ""};
+  const size_t expectedUsed[] = {5, 25, 0, 2};
+  size_t pos = 0;
+  size_t outLen;
+  size_t used;
+
+  // Unquote each field in place, as a reader splitting the record would
+  for (size_t i = 0; i < 4; ++i)
+  {
+    TEST_ASSERT_TRUE(ntk_unescape_csv(record + pos, strlen(record) - pos, record + pos, &outLen, &used));
+    TEST_ASSERT_EQUAL_size_t(expectedUsed[i], used);
+    TEST_ASSERT_EQUAL_size_t(strlen(expected[i]), outLen);
+    if (outLen > 0)
+    {
+      TEST_ASSERT_EQUAL_CHAR_ARRAY(expected[i], record + pos, outLen);
+    }
+    pos += used + 1;
+  }
+  TEST_ASSERT_EQUAL_CHAR('\r', record[pos - 1]);
+
+  char out[32];
+  TEST_ASSERT_TRUE(ntk_unescape_csv("last", 4, out, &outLen, &used));
+  TEST_ASSERT_EQUAL_size_t(4, used);
+  TEST_ASSERT_TRUE(ntk_unescape_csv("", 0, out, &outLen, &used));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+
+  TEST_ASSERT_FALSE(ntk_unescape_csv("\"open", 5, out, &outLen, &used));
+  TEST_ASSERT_FALSE(ntk_unescape_csv("\"a\"b", 4, out, &outLen, &used));
+  TEST_ASSERT_FALSE(ntk_unescape_csv("a\"b", 3, out, &outLen, &used));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  TEST_ASSERT_EQUAL_size_t(0, used);
+}
+
+void test_EscapeJs(void)
+{
+  const char* pIn = "</script><!-- it's \"${x}\" `\\` \x01\t\n caf\xC3\xA9 \xE2\x80\xA8\xE2\x80\xA9";
+  const char* pExp = "\\x3C/script\\x3E\\x3C!-- it\\'s \\\"\\${x}\\\" \\`\\\\\\` \\x01\\t\\n "
+                     "caf\xC3\xA9 \\u2028\\u2029";
+  char out[128];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_escape_js_length(pIn, strlen(pIn)));
+  TEST_ASSERT_TRUE(ntk_escape_js(pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  TEST_ASSERT_FALSE(ntk_escape_js("<a\xC0\xAF", 4, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  TEST_ASSERT_EQUAL_size_t(8, ntk_escape_js_length("<a\xC0\xAF", 4));
+  TEST_ASSERT_TRUE(ntk_escape_js_sanitized("<a\xC0\xAF", 4, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(8, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("\\x3Ca\xEF\xBF\xBD", out, outLen);
+}
+
+static size_t join_spans(const struct ntk_span* pSpans, size_t spanCount, char* pOut)
+{
+  size_t outLen = 0;
+
+  for (size_t i = 0; i < spanCount; ++i)
+  {
+    TEST_ASSERT_NOT_EQUAL(0, pSpans[i].len);
+    memcpy(pOut + outLen, pSpans[i].pData, pSpans[i].len);
+    outLen += pSpans[i].len;
+  }
+
+  return outLen;
+}
+
+void test_EscapeSpans(void)
+{
+  const char* pIn = "<p class=\"x\">Tom & Jerry</p>";
+  struct ntk_span spans[16];
+  size_t spanCount;
+  char expected[128];
+  size_t expectedLen;
+  char out[128];
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pIn), ntk_escape_spans(pIn, strlen(pIn), ntk_escape_format_html, spans, 16,
+                                                         &spanCount));
+  TEST_ASSERT_EQUAL_size_t(12, spanCount);
+  TEST_ASSERT_EQUAL_PTR(pIn + 1, spans[1].pData);
+  TEST_ASSERT_TRUE(ntk_escape_html(pIn, strlen(pIn), expected, &expectedLen));
+  TEST_ASSERT_EQUAL_size_t(expectedLen, join_spans(spans, spanCount, out));
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, out, expectedLen);
+
+  // Escaping resumes where the spans ran out, without splitting a run of invalid sequences
+  const char* pMixed = "a\xFF\xFE\x01\"b\xE2\x80\xA8\xC3\xA9\xC3";
+  TEST_ASSERT_TRUE(ntk_escape_js_sanitized(pMixed, strlen(pMixed), expected, &expectedLen));
+
+  for (size_t maxSpans = 1; maxSpans <= 16; ++maxSpans)
+  {
+    size_t used = 0;
+    size_t outLen = 0;
+
+    while (used < strlen(pMixed))
+    {
+      size_t covered = ntk_escape_spans(pMixed + used, strlen(pMixed) - used, ntk_escape_format_js, spans, maxSpans,
+                                        &spanCount);
+      TEST_ASSERT_NOT_EQUAL(0, covered);
+      used += covered;
+      outLen += join_spans(spans, spanCount, out + outLen);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(expectedLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, out, outLen);
+  }
+
+  // Dropped characters need no span
+  TEST_ASSERT_EQUAL_size_t(3, ntk_escape_spans("a\x01" "b", 3, ntk_escape_format_xml, spans, 16, &spanCount));
+  TEST_ASSERT_EQUAL_size_t(2, spanCount);
+
+  TEST_ASSERT_EQUAL_size_t(0, ntk_escape_spans(pIn, strlen(pIn), (enum ntk_escape_format)99, spans, 16, &spanCount));
+  TEST_ASSERT_EQUAL_size_t(0, spanCount);
+}
+
+void test_SanitizeTruncated(void)
+{
+  // A sequence cut short is replaced whole, and whatever interrupted it is kept
+  const char* inputs[] = {"a\xE2\x82" "b", "ab\xE2", "\xE2\x82\xE2\x82\xAC", "\xF0\x9F\x98" "\xC3\xA9"};
+  const char* expected[] = {"a\xEF\xBF\xBD" "b", "ab\xEF\xBF\xBD", "\xEF\xBF\xBD\xE2\x82\xAC",
+                            "\xEF\xBF\xBD\xC3\xA9"};
+
+  for (size_t i = 0; i < 4; ++i)
+  {
+    size_t len;
+    char* pActual = ntk_sanitize_utf8(inputs[i], strlen(inputs[i]), &len);
+    TEST_ASSERT_EQUAL_size_t(strlen(expected[i]), len);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(expected[i], pActual, len);
+    free(pActual);
+  }
+}
+
+void test_EscapeSanitized(void)
+{
+  const char* pIn = "<a href=\"?q=1&r=2\">caf\xC3\xA9 \xE2\x80\xA8 \x01\xFF\xFE</a\xE2\x82>";
+  size_t sanitizedLen;
+  char* pSanitized = ntk_sanitize_utf8(pIn, strlen(pIn), &sanitizedLen);
+  char expected[256];
+  size_t expectedLen;
+  size_t outLen;
+
+  // Each fused escaper matches sanitizing and then escaping
+  for (int format = ntk_escape_format_html; format <= ntk_escape_format_html_attribute_unquoted; ++format)
+  {
+    switch (format)
+    {
+      case ntk_escape_format_html:
+        TEST_ASSERT_TRUE(ntk_escape_html(pSanitized, sanitizedLen, expected, &expectedLen));
+        break;
+      case ntk_escape_format_html_attribute:
+        TEST_ASSERT_TRUE(ntk_escape_html_attribute(pSanitized, sanitizedLen, ntk_html_attribute_double_quoted, expected,
+                                                   &expectedLen));
+        break;
+      case ntk_escape_format_json:
+        TEST_ASSERT_TRUE(ntk_escape_json(pSanitized, sanitizedLen, 0, expected, &expectedLen));
+        break;
+      case ntk_escape_format_js:
+        TEST_ASSERT_TRUE(ntk_escape_js(pSanitized, sanitizedLen, expected, &expectedLen));
+        break;
+      case ntk_escape_format_xml:
+        TEST_ASSERT_TRUE(ntk_escape_xml(pSanitized, sanitizedLen, 0, expected, &expectedLen));
+        break;
+      case ntk_escape_format_html_attribute_single_quoted:
+        TEST_ASSERT_TRUE(ntk_escape_html_attribute(pSanitized, sanitizedLen, ntk_html_attribute_single_quoted, expected,
+                                                   &expectedLen));
+        break;
+      default:
+        TEST_ASSERT_TRUE(ntk_escape_html_attribute(pSanitized, sanitizedLen, ntk_html_attribute_unquoted, expected,
+                                                   &expectedLen));
+        break;
+    }
+
+    TEST_ASSERT_EQUAL_size_t(expectedLen, ntk_escape_sanitized_length(pIn, strlen(pIn), format));
+    char* pActual = ntk_escape_sanitized_alloc(pIn, strlen(pIn), format, &outLen);
+    TEST_ASSERT_EQUAL_size_t(expectedLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, pActual, outLen);
+    free(pActual);
+  }
+
+  TEST_ASSERT_TRUE(ntk_escape_url(pSanitized, sanitizedLen, ntk_url_form, expected, &expectedLen));
+  TEST_ASSERT_FALSE(ntk_escape_url(pIn, strlen(pIn), ntk_url_form, expected + expectedLen, &outLen));
+  TEST_ASSERT_EQUAL_size_t(expectedLen, ntk_escape_url_sanitized_length(pIn, strlen(pIn), ntk_url_form));
+  char* pActual = ntk_escape_url_sanitized_alloc(pIn, strlen(pIn), ntk_url_form, &outLen);
+  TEST_ASSERT_EQUAL_size_t(expectedLen, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, pActual, outLen);
+  free(pActual);
+
+  free(pSanitized);
+
+  TEST_ASSERT_NULL(ntk_escape_sanitized_alloc(pIn, strlen(pIn), (enum ntk_escape_format)99, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+}
+
+void test_EscapeCustom(void)
+{
+  // A log field format: | and \ are escaped, line breaks spelled out, other controls except tab dropped, and bidi
+  // controls and private use characters replaced
+  const char* asciiEscapes[0x80] = {NULL};
+  for (int c = 0; c < 0x20; ++c)
+  {
+    asciiEscapes[c] = "";
+  }
+  asciiEscapes['\t'] = NULL;
+  asciiEscapes['\n'] = "\\n";
+  asciiEscapes['\r'] = "\\r";
+  asciiEscapes['|'] = "\\|";
+  asciiEscapes['\\'] = "\\\\";
+
+  char replacement[] = "<?>";
+  const struct ntk_code_point_escape ranges[] = {
+    {0x202AU, 0x202EU, "<bidi>"},
+    {0xE000U, 0xF8FFU, replacement},
+  };
+
+  struct ntk_escaper* pEscaper = ntk_escaper_create(asciiEscapes, ranges, 2);
+  TEST_ASSERT_NOT_NULL(pEscaper);
+
+  // Replacements are copied
+  replacement[1] = '!';
+
+  const char* pIn = "user=a|b\tpath=C:\\x\r\n\x01\x1B[0m caf\xC3\xA9 \xE2\x80\xAE" "evil \xEE\x80\x80 tail of the line";
+  const char* pExp = "user=a\\|b\tpath=C:\\\\x\\r\\n[0m caf\xC3\xA9 <bidi>evil <?> tail of the line";
+  char out[128];
+  size_t outLen;
+
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), ntk_escape_custom_length(pEscaper, pIn, strlen(pIn)));
+  TEST_ASSERT_TRUE(ntk_escape_custom(pEscaper, pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pExp), outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY(pExp, out, outLen);
+
+  TEST_ASSERT_FALSE(ntk_escape_custom(pEscaper, "a|\xFF", 3, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(0, outLen);
+  TEST_ASSERT_TRUE(ntk_escape_custom_sanitized(pEscaper, "a|\xFF", 3, out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(6, outLen);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("a\\|\xEF\xBF\xBD", out, outLen);
+
+  free(pEscaper);
+
+  // Without any escapes, text is only validated
+  pEscaper = ntk_escaper_create(NULL, NULL, 0);
+  TEST_ASSERT_NOT_NULL(pEscaper);
+  TEST_ASSERT_TRUE(ntk_escape_custom(pEscaper, pIn, strlen(pIn), out, &outLen));
+  TEST_ASSERT_EQUAL_size_t(strlen(pIn), outLen);
+  free(pEscaper);
+
+  // Escaped bytes spread over more ranges than are compared a word at a time, so gaps between them are rechecked
+  const char* spread[0x80] = {NULL};
+  const char* pSpread = "#%')+-/;<=>@[]^`{|}~aeiouAEIOU";
+  for (const char* p = pSpread; *p != '\0'; ++p)
+  {
+    spread[(unsigned char)*p] = "()";
+  }
+
+  pEscaper = ntk_escaper_create(spread, NULL, 0);
+  TEST_ASSERT_NOT_NULL(pEscaper);
+
+  char text[96];
+  char expected[3 * 96];
+  for (int round = 0; round < 200; ++round)
+  {
+    size_t expectedLen = 0;
+    for (size_t i = 0; i < sizeof(text); ++i)
+    {
+      text[i] = (char)(0x20 + rand() % 0x5F);
+      if (strchr(pSpread, text[i]) != NULL)
+      {
+        memcpy(expected + expectedLen, "()", 2);
+        expectedLen += 2;
+      }
+      else
+      {
+        expected[expectedLen++] = text[i];
+      }
+    }
+
+    char escaped[3 * 96];
+    TEST_ASSERT_TRUE(ntk_escape_custom(pEscaper, text, sizeof(text), escaped, &outLen));
+    TEST_ASSERT_EQUAL_size_t(expectedLen, outLen);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, escaped, outLen);
+  }
+  free(pEscaper);
+
+  const struct ntk_code_point_escape ascii[] = {{0x41U, 0x5AU, ""}};
+  const struct ntk_code_point_escape reversed[] = {{0xE000U, 0xD000U, ""}};
+  TEST_ASSERT_NULL(ntk_escaper_create(NULL, ascii, 1));
+  TEST_ASSERT_NULL(ntk_escaper_create(NULL, reversed, 1));
+  TEST_ASSERT_NULL(ntk_escaper_create(NULL, NULL, 1));
+}
+
+void test_CountCodePoints(void)
+{
+  const char* pIn = "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80!";
+  size_t count;
+
+  TEST_ASSERT_EQUAL_size_t(9, ntk_utf8_count_code_points(pIn, strlen(pIn)));
+  TEST_ASSERT_TRUE(ntk_utf8_count_code_points_validated(pIn, strlen(pIn), &count));
+  TEST_ASSERT_EQUAL_size_t(9, count);
+
+  TEST_ASSERT_EQUAL_size_t(0, ntk_utf8_count_code_points(NULL, 3));
+  TEST_ASSERT_TRUE(ntk_utf8_count_code_points_validated("", 0, &count));
+  TEST_ASSERT_EQUAL_size_t(0, count);
+
+  TEST_ASSERT_FALSE(ntk_utf8_count_code_points_validated("ab\xE2\x82", 4, &count));
+  TEST_ASSERT_EQUAL_size_t(0, count);
+  TEST_ASSERT_FALSE(ntk_utf8_count_code_points_validated("ab\xC0\xAF" "cd", 6, &count));
+
+  // Long enough for the per-lane tallies to be added together more than once
+  size_t len = 3 * 255 * sizeof(uint64_t) + 5;
+  char* pBuf = malloc(len);
+  TEST_ASSERT_NOT_NULL(pBuf);
+  size_t expected = 0;
+  for (size_t i = 0; i < len; ++expected)
+  {
+    if (len - i >= 3 && expected % 3 == 0)
+    {
+      memcpy(pBuf + i, "\xE2\x82\xAC", 3);
+      i += 3;
+    }
+    else if (len - i >= 2 && expected % 3 == 1)
+    {
+      memcpy(pBuf + i, "\xC3\xA9", 2);
+      i += 2;
+    }
+    else
+    {
+      pBuf[i++] = 'a';
+    }
+  }
+
+  TEST_ASSERT_EQUAL_size_t(expected, ntk_utf8_count_code_points(pBuf, len));
+  TEST_ASSERT_TRUE(ntk_utf8_count_code_points_validated(pBuf, len, &count));
+  TEST_ASSERT_EQUAL_size_t(expected, count);
+  free(pBuf);
+
+  TEST_ASSERT_TRUE(ntk_utf8_count_code_points_validated((const char*)uni_hannover_html, uni_hannover_html_len, &count));
+  TEST_ASSERT_EQUAL_size_t(ntk_utf8_count_code_points((const char*)uni_hannover_html, uni_hannover_html_len), count);
+}
+
 int main(void)
 {
   UNITY_BEGIN();
@@ -300,6 +1790,47 @@ int main(void)
   RUN_TEST(test_HannoverHtml);
   RUN_TEST(test_SanitizeInvalid);
   RUN_TEST(test_SanitizeValid);
+  RUN_TEST(test_Latin1ToUtf8);
+  RUN_TEST(test_Latin1AllBytesRoundTrip);
+  RUN_TEST(test_Utf8ToLatin1Failures);
+  RUN_TEST(test_LengthsAsciiAndMixed);
+  RUN_TEST(test_LengthsBoundaries);
+  RUN_TEST(test_CharsetWindows1252);
+  RUN_TEST(test_CharsetOthers);
+  RUN_TEST(test_CharsetAllTablesValid);
+  RUN_TEST(test_Cesu8);
+  RUN_TEST(test_ModifiedUtf8);
+  RUN_TEST(test_Wtf8);
+  RUN_TEST(test_Wtf8Invalid);
+  RUN_TEST(test_Utf16ToUtf8Lossy);
+  RUN_TEST(test_Utf16ByteOrders);
+  RUN_TEST(test_Utf16Invalid);
+  RUN_TEST(test_Utf32ByteOrders);
+  RUN_TEST(test_SniffBom);
+  RUN_TEST(test_SniffUnicode);
+  RUN_TEST(test_SniffSingleByte);
+  RUN_TEST(test_MultibyteCharsets);
+  RUN_TEST(test_MultibyteInvalid);
+  RUN_TEST(test_MultibyteStreaming);
+  RUN_TEST(test_EscapeHtml);
+  RUN_TEST(test_EscapeHtmlAttribute);
+  RUN_TEST(test_EscapeUrl);
+  RUN_TEST(test_UnescapeUrl);
+  RUN_TEST(test_EscapeC);
+  RUN_TEST(test_UnescapeC);
+  RUN_TEST(test_EscapeJson);
+  RUN_TEST(test_UnescapeJson);
+  RUN_TEST(test_EscapeXml);
+  RUN_TEST(test_UnescapeHtml);
+  RUN_TEST(test_EscapeShell);
+  RUN_TEST(test_EscapeCsv);
+  RUN_TEST(test_UnescapeCsv);
+  RUN_TEST(test_EscapeJs);
+  RUN_TEST(test_EscapeSpans);
+  RUN_TEST(test_SanitizeTruncated);
+  RUN_TEST(test_EscapeSanitized);
+  RUN_TEST(test_EscapeCustom);
+  RUN_TEST(test_CountCodePoints);
 
   RUN_TEST(test_SanitizeFuzz);
   return UNITY_END();
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Generate ntk_charset_tables.h, the upper-half mappings for ntk's single-byte character set decoders.
+
+Table order must match enum ntk_charset in ntk.h. Bytes with no mapping decode to U+FFFD.
+
+Each character set also gets a table of per-byte weights for ntk_sniff_encoding: lowercase and caseless letters are
+most likely in real text, capitals less so, and controls or unassigned bytes are strong evidence against the charset.
+Character sets whose upper half is mostly Latin letters are flagged, since text in those is still mostly ASCII.
+
+Usage: tools/gen_charset_tables.py > ntk_charset_tables.h
+"""
+
+import unicodedata
+
+
+CHARSETS = [
+    ("ISO-8859-1", "iso8859_1"),
+    ("ISO-8859-2", "iso8859_2"),
+    ("ISO-8859-3", "iso8859_3"),
+    ("ISO-8859-4", "iso8859_4"),
+    ("ISO-8859-5", "iso8859_5"),
+    ("ISO-8859-6", "iso8859_6"),
+    ("ISO-8859-7", "iso8859_7"),
+    ("ISO-8859-8", "iso8859_8"),
+    ("ISO-8859-9", "iso8859_9"),
+    ("ISO-8859-10", "iso8859_10"),
+    ("ISO-8859-11", "iso8859_11"),
+    ("ISO-8859-13", "iso8859_13"),
+    ("ISO-8859-14", "iso8859_14"),
+    ("ISO-8859-15", "iso8859_15"),
+    ("ISO-8859-16", "iso8859_16"),
+    ("Windows-1250", "cp1250"),
+    ("Windows-1251", "cp1251"),
+    ("Windows-1252", "cp1252"),
+    ("Windows-1253", "cp1253"),
+    ("Windows-1254", "cp1254"),
+    ("Windows-1255", "cp1255"),
+    ("Windows-1256", "cp1256"),
+    ("Windows-1257", "cp1257"),
+    ("Windows-1258", "cp1258"),
+    ("KOI8-R", "koi8_r"),
+]
+
+
+def upper_half(codec):
+    ret = []
+    for b in range(0x80, 0x100):
+        try:
+            ret.append(ord(bytes([b]).decode(codec)))
+        except UnicodeDecodeError:
+            ret.append(0xFFFD)
+    return ret
+
+
+def weight(code_point):
+    if code_point == 0xFFFD:
+        return -4
+    category = unicodedata.category(chr(code_point))
+    if category in ("Ll", "Lo"):
+        return 2
+    if category[0] == "L" or category == "Mn":
+        return 1
+    if category == "Cc":
+        return -4
+    return 0
+
+
+def is_latin(codec):
+    letters = [v for v in upper_half(codec) if v != 0xFFFD and unicodedata.category(chr(v))[0] == "L"]
+    latin = [v for v in letters if unicodedata.name(chr(v)).startswith("LATIN")]
+    return 2 * len(latin) > len(letters)
+
+
+def main():
+    print("#ifndef NTK_CHARSET_TABLES_H")
+    print("#define NTK_CHARSET_TABLES_H")
+    print()
+    print("// Generated by tools/gen_charset_tables.py. Do not edit.")
+    print("// Code points for bytes 0x80 - 0xFF of each single-byte character set, in enum ntk_charset order.")
+    print()
+    print("static const uint16_t charset_tables[][128] = {")
+    for name, codec in CHARSETS:
+        values = upper_half(codec)
+        print("  // %s" % name)
+        print("  {")
+        for row in range(0, 128, 8):
+            print("    " + ", ".join("0x%04X" % v for v in values[row:row + 8]) + ",")
+        print("  },")
+    print("};")
+    print()
+    print("// Likelihood weights for bytes 0x80 - 0xFF of each single-byte character set, in enum ntk_charset order.")
+    print()
+    print("static const signed char charset_weights[][128] = {")
+    for name, codec in CHARSETS:
+        values = [weight(v) for v in upper_half(codec)]
+        print("  // %s" % name)
+        print("  {")
+        for row in range(0, 128, 16):
+            print("    " + ", ".join("%d" % v for v in values[row:row + 16]) + ",")
+        print("  },")
+    print("};")
+    print()
+    print("// Whether the upper half of each single-byte character set is mostly Latin letters, in enum ntk_charset order.")
+    print()
+    print("static const unsigned char charset_is_latin[] = {")
+    for name, codec in CHARSETS:
+        print("  %d, // %s" % (1 if is_latin(codec) else 0, name))
+    print("};")
+    print()
+    print("#endif // NTK_CHARSET_TABLES_H")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Generate ntk_cjk_tables.h, the index tables for ntk's multi-byte CJK decoders.
+
+Each table maps a (lead, trail) byte pair to a BMP code point, with 0 marking pairs that have no mapping:
+
+* jis0208: Shift_JIS pointer order ((lead index * 188) + trail index), shared by Shift_JIS and EUC-JP. Covers
+  JIS X 0208 plus the NEC and IBM extensions and user-defined rows, as Windows code page 932 does.
+* jis0212: JIS X 0212, for EUC-JP's three-byte sequences, indexed by (row * 94) + cell.
+* gb18030, big5, euc_kr: every byte pair in a contiguous lead and trail range, as described by the accompanying
+  *_lead_min / *_trail_min constants.
+
+GB18030's four-byte sequences for the BMP are described by a list of ranges over the four-byte pointer, within which
+code points increase by one per pointer.
+
+Usage: tools/gen_cjk_tables.py > ntk_cjk_tables.h
+"""
+
+
+def decode(data, codec):
+    try:
+        text = data.decode(codec)
+    except UnicodeDecodeError:
+        return 0
+    if len(text) != 1 or ord(text) < 0x80 or ord(text) > 0xFFFF:
+        return 0
+    return ord(text)
+
+
+def jis0208():
+    ret = []
+    for pointer in range(120 * 94):
+        row, cell = divmod(pointer, 94)
+        lead = row // 2 + (0x81 if row < 62 else 0xC1)
+        offset = (row % 2) * 94 + cell
+        trail = offset + (0x40 if offset < 0x3F else 0x41)
+        ret.append(decode(bytes([lead, trail]), "cp932"))
+    return ret
+
+
+def jis0212():
+    return [decode(bytes([0x8F, 0xA1 + row, 0xA1 + cell]), "euc_jp") for row in range(94) for cell in range(94)]
+
+
+def double_byte(codec, lead_min, lead_max, trail_min, trail_max):
+    return [decode(bytes([lead, trail]), codec)
+            for lead in range(lead_min, lead_max + 1) for trail in range(trail_min, trail_max + 1)]
+
+
+def gb18030_ranges():
+    ranges = []
+    for pointer in range(39420):
+        b4 = 0x30 + pointer % 10
+        b3 = 0x81 + pointer // 10 % 126
+        b2 = 0x30 + pointer // 1260 % 10
+        b1 = 0x81 + pointer // 12600
+        try:
+            code_point = ord(bytes([b1, b2, b3, b4]).decode("gb18030"))
+        except UnicodeDecodeError:
+            continue
+        if ranges and ranges[-1][0] + (pointer - ranges[-1][1]) == code_point and ranges[-1][2] == pointer - 1:
+            ranges[-1][2] = pointer
+        else:
+            ranges.append([code_point, pointer, pointer])
+    return ranges
+
+
+def print_table(name, values):
+    print("static const uint16_t %s[%d] = {" % (name, len(values)))
+    for row in range(0, len(values), 12):
+        print("  " + ", ".join("0x%04X" % v for v in values[row:row + 12]) + ",")
+    print("};")
+    print()
+
+
+DOUBLE_BYTE = [
+    # name, codec, lead range, trail range
+    ("gb18030", "gb18030", 0x81, 0xFE, 0x40, 0xFE),
+    ("big5", "cp950", 0xA1, 0xF9, 0x40, 0xFE),
+    ("euc_kr", "cp949", 0x81, 0xFE, 0x41, 0xFE),
+]
+
+
+def main():
+    print("#ifndef NTK_CJK_TABLES_H")
+    print("#define NTK_CJK_TABLES_H")
+    print()
+    print("// Generated by tools/gen_cjk_tables.py. Do not edit.")
+    print()
+    print_table("jis0208_table", jis0208())
+    print_table("jis0212_table", jis0212())
+    print("enum double_byte_ranges")
+    print("{")
+    for name, codec, lead_min, lead_max, trail_min, trail_max in DOUBLE_BYTE:
+        print("  %s_lead_min = 0x%02X," % (name, lead_min))
+        print("  %s_lead_max = 0x%02X," % (name, lead_max))
+        print("  %s_trail_min = 0x%02X," % (name, trail_min))
+        print("  %s_trail_max = 0x%02X," % (name, trail_max))
+    print("};")
+    print()
+    for name, codec, lead_min, lead_max, trail_min, trail_max in DOUBLE_BYTE:
+        print_table("%s_table" % name, double_byte(codec, lead_min, lead_max, trail_min, trail_max))
+    print("// GB18030 four-byte pointer ranges for the BMP: first pointer, and the code point it maps to")
+    print("static const uint32_t gb18030_ranges[][2] = {")
+    for code_point, first, last in gb18030_ranges():
+        print("  {%d, 0x%04X}," % (first, code_point))
+    print("};")
+    print()
+    print("#endif // NTK_CJK_TABLES_H")
+
+
+if __name__ == "__main__":
+    main()
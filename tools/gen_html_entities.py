@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Generate ntk_html_entities.h, the named character references for ntk_unescape_html.
+
+The table holds every name in the HTML standard (including the legacy names which may omit the trailing semicolon),
+as listed by Python's html.entities.html5, arranged by a minimal perfect hash so each name is found with two hash
+computations and one comparison:
+
+    slot = html_entity_hash(name, html_entity_displacements[html_entity_hash(name, 0) % html_entity_buckets])
+           % html_entity_count
+
+html_entity_hash is 32-bit FNV-1a started from 0x811C9DC5 ^ (seed * 0x9E3779B9), and must match hash() below.
+
+Usage: tools/gen_html_entities.py > ntk_html_entities.h
+"""
+
+from html.entities import html5
+
+BUCKET_SIZE = 4
+
+
+def hash(name, seed):
+    h = (0x811C9DC5 ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    for c in name.encode("ascii"):
+        h = ((h ^ c) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def build(names):
+    count = len(names)
+    buckets = (count + BUCKET_SIZE - 1) // BUCKET_SIZE
+    by_bucket = [[] for _ in range(buckets)]
+    for name in names:
+        by_bucket[hash(name, 0) % buckets].append(name)
+
+    displacements = [0] * buckets
+    slots = [None] * count
+    for bucket in sorted(range(buckets), key=lambda b: -len(by_bucket[b])):
+        members = by_bucket[bucket]
+        if not members:
+            continue
+        seed = 1
+        while True:
+            chosen = [hash(name, seed) % count for name in members]
+            if len(set(chosen)) == len(chosen) and all(slots[s] is None for s in chosen):
+                break
+            seed += 1
+        assert seed <= 0xFFFF
+        displacements[bucket] = seed
+        for name, slot in zip(members, chosen):
+            slots[slot] = name
+    return buckets, displacements, slots
+
+
+def main():
+    names = sorted(html5)
+    buckets, displacements, slots = build(names)
+
+    print("#ifndef NTK_HTML_ENTITIES_H")
+    print("#define NTK_HTML_ENTITIES_H")
+    print()
+    print("// Generated by tools/gen_html_entities.py. Do not edit.")
+    print()
+    print("enum html_entities")
+    print("{")
+    print("  html_entity_count = %d," % len(slots))
+    print("  html_entity_buckets = %d," % buckets)
+    print("  html_entity_max_name = %d, // Including the semicolon" % max(map(len, names)))
+    print("  html_entity_max_legacy_name = %d, // Longest name which may omit the semicolon"
+          % max(len(n) for n in names if not n.endswith(";")))
+    print("};")
+    print()
+    print("static const uint16_t html_entity_displacements[%d] = {" % buckets)
+    for row in range(0, buckets, 16):
+        print("  " + ", ".join("%d" % d for d in displacements[row:row + 16]) + ",")
+    print("};")
+    print()
+    print("// Names without the leading &, by slot")
+    print("static const char* const html_entity_names[%d] = {" % len(slots))
+    line = " "
+    for name in slots:
+        item = ' "%s",' % name
+        if len(line) + len(item) > 120:
+            print(line)
+            line = " "
+        line += item
+    print(line)
+    print("};")
+    print()
+    print("// One or two code points for each slot, with 0 for none")
+    print("static const uint32_t html_entity_code_points[%d][2] = {" % len(slots))
+    line = " "
+    for name in slots:
+        value = [ord(c) for c in html5[name]] + [0]
+        item = " {0x%X, 0x%X}," % (value[0], value[1])
+        if len(line) + len(item) > 120:
+            print(line)
+            line = " "
+        line += item
+    print(line)
+    print("};")
+    print()
+    print("#endif // NTK_HTML_ENTITIES_H")
+
+
+if __name__ == "__main__":
+    main()